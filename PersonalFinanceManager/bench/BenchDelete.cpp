@@ -0,0 +1,77 @@
+//
+//  BenchDelete.cpp
+//  PersonalFinanceManager
+//
+//  Deletes random transactions by ID from a large ledger, then re-dates and
+//  back-dates a sample, timing each (all O(log N) per record).
+//
+//  Usage: bench_delete [rows = 1000000] [deletes = 100000]
+//
+
+#include "BenchSupport.h"
+#include "Models/Transaction.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace BenchSupport;
+
+static void PrintRate(const char* name, size_t count, double ms) {
+    std::printf("%-18s %8zu  %9.1f ms  %7.2f us each\n", name, count, ms, count == 0 ? 0.0 : ms * 1000 / count);
+}
+
+int main(int argc, char* argv[]) {
+    size_t rows = ArgCount(argc, argv, 1, 1000000);
+    size_t deletes = std::min(ArgCount(argc, argv, 2, 100000), rows);
+    size_t edits = std::min<size_t>(10000, rows - deletes);
+
+    EnterScratchDirectory();
+    AppController* app = new AppController(nullptr);
+
+    const char* descriptions[] = { "Coffee" };
+    LedgerShape shape = { rows, 300, 8, 8, 0, 0, Date(1, 1, 2000), descriptions, 1 };
+    Clock::time_point start = Clock::now();
+    BuildLedger(*app, shape);
+    std::printf("ledger: %zu rows, 8 wallets, 8 categories, 300 rows per day (built in %.1f s)\n",
+                rows, MillisecondsSince(start) / 1000);
+
+    std::vector<std::string> ids;
+    ids.reserve(rows);
+    for (Transaction* t : *app->GetTransactions()) ids.push_back(t->GetId());
+    std::mt19937 rng(7);
+    std::shuffle(ids.begin(), ids.end(), rng);
+
+    // 1. Deletes by ID
+    start = Clock::now();
+    for (size_t i = 0; i < deletes; ++i) app->DeleteTransaction(ids[i]);
+    double deleteMs = MillisecondsSince(start);
+    PrintRate("delete", deletes, deleteMs);
+
+    // 2. Date-changing edits of surviving rows
+    int years = static_cast<int>(rows / 300 / 365) + 1;
+    start = Clock::now();
+    for (size_t i = deletes; i < deletes + edits; ++i) {
+        Date newDate(1 + rng() % 28, 1 + rng() % 12, 2000 + static_cast<int>(rng() % years));
+        app->EditTransaction(ids[i], 20, newDate, "Coffee");
+    }
+    double editMs = MillisecondsSince(start);
+    PrintRate("re-date edit", edits, editMs);
+
+    // 3. Back-dated inserts
+    ArrayList<Wallet*>* wallets = app->GetWalletsList();
+    ArrayList<Category*>* categories = app->GetCategoriesList();
+    start = Clock::now();
+    for (size_t i = 0; i < edits; ++i) {
+        Date day(1 + rng() % 28, 1 + rng() % 12, 2000 + static_cast<int>(rng() % years));
+        app->AddTransaction(5, wallets->Get(rng() % 8)->GetId(), categories->Get(rng() % 8)->GetId(),
+                            TransactionType::Expense, day, "Backdated");
+    }
+    double insertMs = MillisecondsSince(start);
+    PrintRate("back-dated insert", edits, insertMs);
+
+    Discard(app);
+    return 0;
+}
@@ -0,0 +1,99 @@
+//
+//  BenchQuery.cpp
+//  PersonalFinanceManager
+//
+//  Selectivity matrix for the query planner: each query runs along its
+//  planned access path (RunQuery) and, for comparison, through a full scan
+//  that checks every ledger row with TransactionQuery::Matches.
+//
+//  Usage: bench_query [rows = 1000000] [runs = 10]
+//
+
+#include "BenchSupport.h"
+#include "Models/Transaction.h"
+#include "Models/TransactionQuery.h"
+
+#include <cstdio>
+#include <string>
+
+using namespace BenchSupport;
+
+struct QueryCase {
+    const char* name;
+    TransactionQuery query;
+};
+
+int main(int argc, char* argv[]) {
+    size_t rows = ArgCount(argc, argv, 1, 1000000);
+    size_t runs = ArgCount(argc, argv, 2, 10);
+    if (runs == 0) runs = 1;
+
+    EnterScratchDirectory();
+    AppController* app = new AppController(nullptr);
+
+    const char* descriptions[] = { "Coffee at the corner shop", "Groceries weekly", "Monthly rent payment",
+                                   "Bus ticket", "Electricity bill", "Lunch" };
+    LedgerShape shape = { rows, 300, 8, 8, 0, 0, Date(1, 1, 2000), descriptions, 6 };
+    Clock::time_point start = Clock::now();
+    BuildLedger(*app, shape);
+    std::printf("ledger: %zu rows, 8 wallets, 8 categories, 300 rows per day (built in %.1f s); mean of %zu runs\n\n",
+                rows, MillisecondsSince(start) / 1000, runs);
+
+    // Periods in the middle of the ledger
+    Date middle = Date(1, 1, 2000).AddDays(static_cast<int>(rows / 300 / 2));
+    Date monthStart(1, middle.GetMonth(), middle.GetYear());
+    Date monthEnd = Date::GetEndOfMonth(middle.GetMonth(), middle.GetYear());
+    Date yearStart(1, 1, middle.GetYear());
+    Date yearEnd(31, 12, middle.GetYear());
+    std::string wallet = app->GetWalletsList()->Get(0)->GetId();
+    std::string category = app->GetCategoriesList()->Get(0)->GetId();
+
+    QueryCase cases[] = {
+        { "1 day", TransactionQuery().InDateRange(middle, middle) },
+        { "1 month", TransactionQuery().InDateRange(monthStart, monthEnd) },
+        { "1 year", TransactionQuery().InDateRange(yearStart, yearEnd) },
+        { "wallet", TransactionQuery().InWallet(wallet) },
+        { "wallet + 1 month", TransactionQuery().InWallet(wallet).InDateRange(monthStart, monthEnd) },
+        { "wallet+month+amount+kw", TransactionQuery().InWallet(wallet).InDateRange(monthStart, monthEnd)
+                                        .InAmountRange(10, 509).Containing("coffee", true) },
+        { "category + 1 year", TransactionQuery().InCategory(category).InDateRange(yearStart, yearEnd) },
+        { "amount 1%", TransactionQuery().InAmountRange(10, 19) },
+        { "keyword, limit 50", TransactionQuery().Containing("rent").Limit(50) },
+        { "amount top 20 of 50%", TransactionQuery().InAmountRange(10, 509)
+                                      .SortBy(QuerySort::AmountDescending).Limit(20) },
+    };
+
+    std::printf("%-24s %8s  %-52s %10s %10s\n", "query", "rows", "plan", "planned", "full scan");
+    for (QueryCase& c : cases) {
+        size_t matched = 0;
+        start = Clock::now();
+        for (size_t i = 0; i < runs; ++i) {
+            ArrayList<Transaction*>* result = app->RunQuery(c.query);
+            matched = result->Count();
+            delete result;
+        }
+        double plannedMs = MillisecondsSince(start) / runs;
+
+        // No planner: every ledger row through the same predicate
+        size_t scanned = 0;
+        start = Clock::now();
+        for (size_t i = 0; i < runs; ++i) {
+            scanned = 0;
+            for (Transaction* t : *app->GetTransactions()) {
+                if (c.query.Matches(t, app->GetDescriptions())) ++scanned;
+            }
+        }
+        double scanMs = MillisecondsSince(start) / runs;
+
+        std::string plan = app->PlanQuery(c.query).Describe();
+        std::printf("%-24s %8zu  %-52s %7.3f ms %7.3f ms\n", c.name, matched, plan.c_str(), plannedMs, scanMs);
+        if (c.query.GetLimit() == 0 && scanned != matched) {
+            std::printf("  mismatch: full scan found %zu rows\n", scanned);
+            Discard(app);
+            return 1;
+        }
+    }
+
+    Discard(app);
+    return 0;
+}
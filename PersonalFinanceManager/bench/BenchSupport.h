@@ -0,0 +1,101 @@
+//
+//  BenchSupport.h
+//  PersonalFinanceManager
+//
+
+#ifndef BenchSupport_h
+#define BenchSupport_h
+
+#include "Controllers/AppController.h"
+#include "Models/Wallet.h"
+#include "Models/Category.h"
+#include "Models/IncomeSource.h"
+#include "Utils/Date.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+
+/**
+ * Shared setup for the benchmark programs (built with -DPFM_BENCH=ON).
+ * Every benchmark runs in ./pfm_bench on an empty database, fills it with a
+ * synthetic ledger through the public AppController API and empties it
+ * again before exit, so the application's own data folder is never touched.
+ */
+namespace BenchSupport {
+
+using Clock = std::chrono::steady_clock;
+
+inline double MillisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+/// @brief Positional argument 'index' as a count, or 'fallback' when it is absent.
+inline size_t ArgCount(int argc, char* argv[], int index, size_t fallback) {
+    if (index >= argc) return fallback;
+    return static_cast<size_t>(std::strtoull(argv[index], nullptr, 10));
+}
+
+/// @brief Moves into ./pfm_bench (created if needed) and deletes the data files left there.
+inline void EnterScratchDirectory() {
+    std::filesystem::create_directories("pfm_bench/data");
+    std::filesystem::current_path("pfm_bench");
+    for (const char* file : { "data/wallets.bin", "data/categories.bin", "data/sources.bin",
+                              "data/transactions.bin", "data/recurring.bin" }) {
+        std::remove(file);
+    }
+}
+
+/**
+ * @struct LedgerShape
+ * @brief A deterministic synthetic ledger: row i falls on day i / rowsPerDay
+ * from 'firstDay', costs 10 + i % 1000, goes to wallet i % wallets and
+ * category (i / wallets) % categories, and is an income from a source when
+ * 'incomeEvery' is non-zero and divides i.
+ */
+struct LedgerShape {
+    size_t rows;
+    size_t rowsPerDay;
+    int wallets;
+    int categories;
+    int sources;
+    size_t incomeEvery;
+    Date firstDay;
+    const char* const* descriptions; // Cycled through by row
+    size_t descriptionCount;
+};
+
+inline void BuildLedger(AppController& app, const LedgerShape& shape) {
+    for (int i = 0; i < shape.wallets; ++i) app.AddWallet("Wallet " + std::to_string(i), 0);
+    for (int i = 0; i < shape.categories; ++i) app.AddCategory("Category " + std::to_string(i));
+    for (int i = 0; i < shape.sources; ++i) app.AddIncomeSource("Source " + std::to_string(i));
+
+    ArrayList<Wallet*>* wallets = app.GetWalletsList();
+    ArrayList<Category*>* categories = app.GetCategoriesList();
+    ArrayList<IncomeSource*>* sources = app.GetIncomeSourcesList();
+
+    Date day = shape.firstDay;
+    for (size_t i = 0; i < shape.rows; ++i) {
+        if (i > 0 && i % shape.rowsPerDay == 0) day = day.AddDays(1);
+
+        bool income = shape.incomeEvery != 0 && shape.sources > 0 && i % shape.incomeEvery == 0;
+        const std::string& walletId = wallets->Get(i % shape.wallets)->GetId();
+        const std::string& groupId = income ? sources->Get((i / shape.wallets) % shape.sources)->GetId()
+                                            : categories->Get((i / shape.wallets) % shape.categories)->GetId();
+        app.AddTransaction(static_cast<double>(10 + i % 1000), walletId, groupId,
+                           income ? TransactionType::Income : TransactionType::Expense, day,
+                           shape.descriptions[i % shape.descriptionCount]);
+    }
+}
+
+/// @brief Empties the database, then deletes the controller (its save on exit then writes nothing).
+inline void Discard(AppController* app) {
+    app->ClearDatabase();
+    delete app;
+}
+
+} // namespace BenchSupport
+
+#endif // !BenchSupport_h
@@ -0,0 +1,63 @@
+//
+//  BenchTeardown.cpp
+//  PersonalFinanceManager
+//
+//  Cost of emptying and of destroying a populated controller, per ledger
+//  size: ClearDatabase on one ledger, then on a second one a SaveData and
+//  the destructor, which stops the auto-save thread and saves again
+//  before it frees everything.
+//
+//  Usage: bench_teardown [rows ...] (default 100000 1000000 4000000)
+//
+
+#include "BenchSupport.h"
+
+#include <cstdio>
+#include <vector>
+
+using namespace BenchSupport;
+
+static AppController* BuildApp(size_t rows) {
+    static const char* descriptions[] = { "Coffee at the corner shop", "Groceries weekly", "Monthly rent payment",
+                                          "Bus ticket", "Electricity bill", "Lunch" };
+    LedgerShape shape = { rows, 300, 8, 8, 4, 10, Date(1, 1, 2000), descriptions, 6 };
+
+    AppController* app = new AppController(nullptr);
+    BuildLedger(*app, shape);
+    return app;
+}
+
+int main(int argc, char* argv[]) {
+    std::vector<size_t> sizes;
+    for (int i = 1; i < argc; ++i) sizes.push_back(ArgCount(argc, argv, i, 0));
+    if (sizes.empty()) sizes = { 100000, 1000000, 4000000 };
+
+    EnterScratchDirectory();
+    std::printf("%10s %16s %12s %22s\n", "rows", "ClearDatabase", "SaveData", "delete (save + free)");
+
+    for (size_t rows : sizes) {
+        // 1. Emptying in place
+        AppController* app = BuildApp(rows);
+        Clock::time_point start = Clock::now();
+        app->ClearDatabase();
+        double clearMs = MillisecondsSince(start);
+        delete app;
+
+        // 2. Destruction of a full ledger, with the save it starts with timed on its own first
+        app = BuildApp(rows);
+        start = Clock::now();
+        app->SaveData(true);
+        double saveMs = MillisecondsSince(start);
+
+        start = Clock::now();
+        delete app;
+        double deleteMs = MillisecondsSince(start);
+
+        std::printf("%10zu %13.1f ms %9.1f ms %19.1f ms\n", rows, clearMs, saveMs, deleteMs);
+
+        // Leave no data files behind for the next size
+        app = new AppController(nullptr);
+        Discard(app);
+    }
+    return 0;
+}
@@ -0,0 +1,136 @@
+//
+//  BenchTextScan.cpp
+//  PersonalFinanceManager
+//
+//  Single-thread keyword search over many descriptions: one TextScan::MarkAll
+//  pass over the StringArena that stores them back to back, then a marked-bit
+//  test per description (what RunQuery does for a short or unindexed
+//  keyword), against a std::string::find per description. The
+//  case-insensitive loop folds a reused copy of each description first.
+//  bench_textscan uses the kernel picked at run time; bench_textscan_sse2
+//  and bench_textscan_scalar are the same program built with PFM_NO_AVX2
+//  and PFM_NO_SIMD.
+//
+//  Usage: bench_textscan [descriptions = 1000000] [runs = 10]
+//
+
+#include "Utils/StringArena.h"
+#include "Utils/TextScan.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+static double SecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+static void FoldCase(std::string& text) {
+    for (char& c : text) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+}
+
+/// Descriptions containing the needle, through one MarkAll pass and a bit test per description.
+static size_t MarkedRows(const StringArena& arena, const std::vector<StringRef>& refs, const std::string& needle,
+                         bool ignoreCase, double& markSeconds) {
+    Clock::time_point start = Clock::now();
+    size_t words = TextScan::MarkWords(arena.Size());
+    uint64_t* marks = new uint64_t[words]();
+    TextScan::MarkAll(arena.Buffer(), arena.Size(), needle.data(), needle.size(), ignoreCase, marks);
+    markSeconds = SecondsSince(start);
+
+    size_t matched = 0;
+    for (const StringRef& ref : refs) {
+        if (ref.length >= needle.size() && TextScan::AnyMarked(marks, ref.offset, ref.offset + ref.length - needle.size())) ++matched;
+    }
+    delete[] marks;
+    return matched;
+}
+
+/// Row-by-row reference: the loop the arena pass replaces.
+static size_t FindRows(const std::vector<std::string>& texts, const std::string& needle, bool ignoreCase) {
+    size_t matched = 0;
+    if (!ignoreCase) {
+        for (const std::string& text : texts) {
+            if (text.find(needle) != std::string::npos) ++matched;
+        }
+        return matched;
+    }
+
+    std::string folded = needle, copy;
+    FoldCase(folded);
+    for (const std::string& text : texts) {
+        copy.assign(text);
+        FoldCase(copy);
+        if (copy.find(folded) != std::string::npos) ++matched;
+    }
+    return matched;
+}
+
+int main(int argc, char* argv[]) {
+    size_t rows = argc > 1 ? static_cast<size_t>(std::strtoull(argv[1], nullptr, 10)) : 1000000;
+    size_t runs = argc > 2 ? static_cast<size_t>(std::strtoull(argv[2], nullptr, 10)) : 10;
+    if (rows == 0) rows = 1;
+    if (runs == 0) runs = 1;
+
+    // Two to five words per description, capitalised words mixed in
+    const char* vocabulary[] = { "Coffee", "at", "the", "corner", "shop", "Groceries", "weekly", "Monthly", "rent",
+                                 "payment", "Bus", "ticket", "Electricity", "bill", "Lunch", "with", "team", "Taxi",
+                                 "to", "airport", "Gym", "membership", "Book", "store", "Pharmacy", "refill" };
+    const size_t vocabularySize = sizeof(vocabulary) / sizeof(vocabulary[0]);
+
+    StringArena arena;
+    std::vector<StringRef> refs(rows);
+    std::vector<std::string> texts(rows);
+    std::mt19937 rng(3);
+    for (size_t i = 0; i < rows; ++i) {
+        size_t words = 2 + rng() % 4;
+        std::string text = vocabulary[rng() % vocabularySize];
+        for (size_t w = 1; w < words; ++w) text += std::string(" ") + vocabulary[rng() % vocabularySize];
+        refs[i] = arena.Append(text);
+        texts[i] = text;
+    }
+
+    struct Case { const char* needle; bool ignoreCase; };
+    Case cases[] = {
+        { "k", false }, { "k", true },
+        { "Bu", false }, { "bu", true },
+        { "rocer", false }, { "GROCE", true },
+    };
+
+    std::printf("%zu descriptions (%.1f MB), best of %zu runs, one thread; kernel: %s\n\n", rows,
+                arena.Size() / 1e6, runs, TextScan::KernelName());
+    std::printf("%-8s %-6s %9s %12s %16s %12s %8s\n", "needle", "case", "matched", "MarkAll", "MarkAll + test",
+                "find loop", "speedup");
+    for (const Case& c : cases) {
+        std::string needle = c.needle;
+        double mark = 1e30, marked = 1e30, find = 1e30;
+        size_t markedRows = 0, foundRows = 0;
+        for (size_t i = 0; i < runs; ++i) {
+            double markSeconds = 0;
+            Clock::time_point start = Clock::now();
+            markedRows = MarkedRows(arena, refs, needle, c.ignoreCase, markSeconds);
+            marked = std::min(marked, SecondsSince(start));
+            mark = std::min(mark, markSeconds);
+
+            start = Clock::now();
+            foundRows = FindRows(texts, needle, c.ignoreCase);
+            find = std::min(find, SecondsSince(start));
+        }
+
+        std::printf("%-8s %-6s %9zu %9.2f ms %13.2f ms %9.2f ms %7.2fx\n", c.needle, c.ignoreCase ? "fold" : "exact",
+                    markedRows, mark * 1e3, marked * 1e3, find * 1e3, find / marked);
+        if (markedRows != foundRows) {
+            std::printf("  mismatch: find loop found %zu descriptions\n", foundRows);
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,251 @@
+//
+//  ColumnScan.cpp
+//  PersonalFinanceManager
+//
+
+#include "ColumnScan.h"
+
+#include <cstring>
+#include <limits>
+
+// SSE2 is part of x86-64; AVX2 needs a run-time check and per-function target (GCC/Clang).
+// PFM_NO_AVX2 stops at SSE2 and PFM_NO_SIMD at the scalar loop (used to benchmark each kernel).
+#if !defined(PFM_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+#define COLUMNSCAN_SSE2 1
+#include <emmintrin.h>
+#if defined(__GNUC__) && !defined(PFM_NO_AVX2)
+#define COLUMNSCAN_AVX2 1
+#include <immintrin.h>
+#endif
+#endif
+
+// ==========================================
+// 1. SHARED HELPERS
+// ==========================================
+
+using TotalsKernel = ColumnTotals (*)(const double*, const int32_t*, const uint8_t*, size_t, int32_t, int32_t, int);
+
+static const double POSITIVE_INFINITY = std::numeric_limits<double>::infinity();
+
+/// Folds rows [start, rows) into 'totals' one at a time (kernel tails and the scalar kernel).
+static void AddRows(ColumnTotals& totals, const double* amounts, const int32_t* days, const uint8_t* types, size_t start, size_t rows,
+                    int32_t firstDay, int32_t lastDay, int type) {
+    for (size_t i = start; i < rows; ++i) {
+        if (days[i] < firstDay || days[i] > lastDay) continue;
+        if (type >= 0 && types[i] != type) continue;
+
+        double amount = amounts[i];
+        if (amount < totals.min) totals.min = amount;
+        if (amount > totals.max) totals.max = amount;
+        totals.sum += amount;
+        ++totals.count;
+    }
+}
+
+static ColumnTotals Empty() {
+    ColumnTotals totals;
+    totals.count = 0;
+    totals.sum = 0;
+    totals.min = POSITIVE_INFINITY;
+    totals.max = -POSITIVE_INFINITY;
+    return totals;
+}
+
+// ==========================================
+// 2. SCALAR KERNEL
+// ==========================================
+
+#if !COLUMNSCAN_SSE2
+static ColumnTotals TotalsScalar(const double* amounts, const int32_t* days, const uint8_t* types, size_t rows,
+                                 int32_t firstDay, int32_t lastDay, int type) {
+    ColumnTotals totals = Empty();
+    AddRows(totals, amounts, days, types, 0, rows, firstDay, lastDay, type);
+    return totals;
+}
+#endif
+
+// ==========================================
+// 3. SSE2 KERNEL (2 rows per lane step, 4 per loop)
+// ==========================================
+
+#if COLUMNSCAN_SSE2
+/// Mask of the two rows starting at 'days' that pass, one 64-bit lane per row.
+static inline __m128d PairMask(const int32_t* days, const uint8_t* types, __m128i first, __m128i last, __m128i wanted, bool typed) {
+    int64_t dayPair;
+    std::memcpy(&dayPair, days, sizeof(dayPair));
+    __m128i day = _mm_cvtsi64_si128(dayPair);
+    __m128i outside = _mm_or_si128(_mm_cmplt_epi32(day, first), _mm_cmpgt_epi32(day, last));
+    __m128i keep = _mm_andnot_si128(outside, _mm_cmpeq_epi32(day, day));
+
+    if (typed) {
+        uint16_t typePair;
+        std::memcpy(&typePair, types, sizeof(typePair));
+        __m128i zero = _mm_setzero_si128();
+        __m128i widened = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(typePair), zero), zero);
+        keep = _mm_and_si128(keep, _mm_cmpeq_epi32(widened, wanted));
+    }
+    // Two 32-bit lane masks -> two 64-bit lane masks
+    return _mm_castsi128_pd(_mm_unpacklo_epi32(keep, keep));
+}
+
+static ColumnTotals TotalsSse2(const double* amounts, const int32_t* days, const uint8_t* types, size_t rows,
+                               int32_t firstDay, int32_t lastDay, int type) {
+    const __m128i first = _mm_set1_epi32(firstDay);
+    const __m128i last = _mm_set1_epi32(lastDay);
+    const __m128i wanted = _mm_set1_epi32(type);
+    const __m128d positive = _mm_set1_pd(POSITIVE_INFINITY);
+    const __m128d negative = _mm_set1_pd(-POSITIVE_INFINITY);
+    const bool typed = type >= 0;
+
+    // Two independent accumulator sets, so consecutive steps do not wait on each other's adds;
+    // a passing lane's mask is -1, so subtracting masks counts rows
+    __m128d sum[2] = { _mm_setzero_pd(), _mm_setzero_pd() };
+    __m128d low[2] = { positive, positive };
+    __m128d high[2] = { negative, negative };
+    __m128i count[2] = { _mm_setzero_si128(), _mm_setzero_si128() };
+
+    size_t i = 0;
+    for (; i + 4 <= rows; i += 4) {
+        for (int half = 0; half < 2; ++half) {
+            size_t row = i + 2 * half;
+            __m128d mask = PairMask(days + row, types + row, first, last, wanted, typed);
+            __m128d amount = _mm_loadu_pd(amounts + row);
+            __m128d kept = _mm_and_pd(mask, amount);
+
+            sum[half] = _mm_add_pd(sum[half], kept);
+            low[half] = _mm_min_pd(low[half], _mm_or_pd(kept, _mm_andnot_pd(mask, positive)));
+            high[half] = _mm_max_pd(high[half], _mm_or_pd(kept, _mm_andnot_pd(mask, negative)));
+            count[half] = _mm_sub_epi64(count[half], _mm_castpd_si128(mask));
+        }
+    }
+
+    double sums[2], lows[2], highs[2];
+    int64_t counts[2];
+    _mm_storeu_pd(sums, _mm_add_pd(sum[0], sum[1]));
+    _mm_storeu_pd(lows, _mm_min_pd(low[0], low[1]));
+    _mm_storeu_pd(highs, _mm_max_pd(high[0], high[1]));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(counts), _mm_add_epi64(count[0], count[1]));
+
+    ColumnTotals totals = Empty();
+    totals.count = static_cast<size_t>(counts[0] + counts[1]);
+    totals.sum = sums[0] + sums[1];
+    totals.min = (lows[0] < lows[1]) ? lows[0] : lows[1];
+    totals.max = (highs[0] > highs[1]) ? highs[0] : highs[1];
+    AddRows(totals, amounts, days, types, i, rows, firstDay, lastDay, type);
+    return totals;
+}
+#endif
+
+// ==========================================
+// 4. AVX2 KERNEL (4 rows per lane step, 8 per loop)
+// ==========================================
+
+#if COLUMNSCAN_AVX2
+/// Mask of the four rows starting at 'days' that pass, one 64-bit lane per row.
+__attribute__((target("avx2")))
+static inline __m256d QuadMask(const int32_t* days, const uint8_t* types, __m128i first, __m128i last, __m128i wanted, bool typed) {
+    __m128i day = _mm_loadu_si128(reinterpret_cast<const __m128i*>(days));
+    __m128i outside = _mm_or_si128(_mm_cmplt_epi32(day, first), _mm_cmpgt_epi32(day, last));
+    __m128i keep = _mm_andnot_si128(outside, _mm_cmpeq_epi32(day, day));
+
+    if (typed) {
+        int32_t typeQuad;
+        std::memcpy(&typeQuad, types, sizeof(typeQuad));
+        keep = _mm_and_si128(keep, _mm_cmpeq_epi32(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(typeQuad)), wanted));
+    }
+    // Four 32-bit lane masks -> four 64-bit lane masks
+    return _mm256_castsi256_pd(_mm256_cvtepi32_epi64(keep));
+}
+
+__attribute__((target("avx2")))
+static ColumnTotals TotalsAvx2(const double* amounts, const int32_t* days, const uint8_t* types, size_t rows,
+                               int32_t firstDay, int32_t lastDay, int type) {
+    const __m128i first = _mm_set1_epi32(firstDay);
+    const __m128i last = _mm_set1_epi32(lastDay);
+    const __m128i wanted = _mm_set1_epi32(type);
+    const __m256d positive = _mm256_set1_pd(POSITIVE_INFINITY);
+    const __m256d negative = _mm256_set1_pd(-POSITIVE_INFINITY);
+    const bool typed = type >= 0;
+
+    // Two accumulator sets, as in the SSE2 kernel
+    __m256d sum[2] = { _mm256_setzero_pd(), _mm256_setzero_pd() };
+    __m256d low[2] = { positive, positive };
+    __m256d high[2] = { negative, negative };
+    __m256i count[2] = { _mm256_setzero_si256(), _mm256_setzero_si256() };
+
+    size_t i = 0;
+    for (; i + 8 <= rows; i += 8) {
+        for (int half = 0; half < 2; ++half) {
+            size_t row = i + 4 * half;
+            __m256d mask = QuadMask(days + row, types + row, first, last, wanted, typed);
+            __m256d amount = _mm256_loadu_pd(amounts + row);
+
+            sum[half] = _mm256_add_pd(sum[half], _mm256_and_pd(mask, amount));
+            low[half] = _mm256_min_pd(low[half], _mm256_blendv_pd(positive, amount, mask));
+            high[half] = _mm256_max_pd(high[half], _mm256_blendv_pd(negative, amount, mask));
+            count[half] = _mm256_sub_epi64(count[half], _mm256_castpd_si256(mask));
+        }
+    }
+
+    double sums[4], lows[4], highs[4];
+    int64_t counts[4];
+    _mm256_storeu_pd(sums, _mm256_add_pd(sum[0], sum[1]));
+    _mm256_storeu_pd(lows, _mm256_min_pd(low[0], low[1]));
+    _mm256_storeu_pd(highs, _mm256_max_pd(high[0], high[1]));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(counts), _mm256_add_epi64(count[0], count[1]));
+
+    ColumnTotals totals = Empty();
+    totals.count = static_cast<size_t>(counts[0] + counts[1] + counts[2] + counts[3]);
+    totals.sum = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+    for (int lane = 0; lane < 4; ++lane) {
+        if (lows[lane] < totals.min) totals.min = lows[lane];
+        if (highs[lane] > totals.max) totals.max = highs[lane];
+    }
+    AddRows(totals, amounts, days, types, i, rows, firstDay, lastDay, type);
+    return totals;
+}
+#endif
+
+// ==========================================
+// 5. DISPATCH
+// ==========================================
+
+static TotalsKernel PickKernel(const char*& name) {
+#if COLUMNSCAN_AVX2
+    if (__builtin_cpu_supports("avx2")) {
+        name = "avx2";
+        return TotalsAvx2;
+    }
+#endif
+#if COLUMNSCAN_SSE2
+    name = "sse2";
+    return TotalsSse2;
+#else
+    name = "scalar";
+    return TotalsScalar;
+#endif
+}
+
+static TotalsKernel ActiveKernel(const char** nameOut = nullptr) {
+    static const char* name = "scalar";
+    static const TotalsKernel kernel = PickKernel(name);
+    if (nameOut != nullptr) *nameOut = name;
+    return kernel;
+}
+
+// ==========================================
+// 6. PUBLIC API
+// ==========================================
+
+ColumnTotals ColumnScan::MaskedTotals(const double* amounts, const int32_t* days, const uint8_t* types, size_t rows,
+                                      int32_t firstDay, int32_t lastDay, int type) {
+    ColumnTotals totals = ActiveKernel()(amounts, days, types, rows, firstDay, lastDay, type);
+    if (totals.count == 0) totals.min = totals.max = 0;
+    return totals;
+}
+
+const char* ColumnScan::KernelName() {
+    const char* name = nullptr;
+    ActiveKernel(&name);
+    return name;
+}
@@ -0,0 +1,50 @@
+//
+//  ColumnScan.h
+//  PersonalFinanceManager
+//
+
+#ifndef ColumnScan_h
+#define ColumnScan_h
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @struct ColumnTotals
+ * @brief Count, sum and extremes of the rows a column scan selected (min/max are 0 when none).
+ */
+struct ColumnTotals {
+    size_t count;
+    double sum;
+    double min;
+    double max;
+};
+
+/**
+ * @class ColumnScan
+ * @brief Vectorized masked aggregation over parallel row columns.
+ *
+ * A row is selected when its day lies in [firstDay, lastDay] and, unless
+ * 'type' is negative, its type byte equals 'type'. The kernels build that
+ * mask for 4 (AVX2) or 2 (SSE2) rows per step, widen it to the amount
+ * lanes and fold the selected amounts into running sum, min and max
+ * vectors, so no branch depends on the data. AVX2 is picked at run time
+ * when the CPU has it; builds with PFM_NO_AVX2 defined stop at SSE2, and
+ * other targets, or builds with PFM_NO_SIMD defined, use a scalar loop.
+ * Sums may differ from a row-by-row loop in the last bits, since the lanes
+ * add in a different order.
+ *
+ * A prototype for bench_scan only. The app's reports do not need it:
+ * date-range totals come from the daily prefix sums, and whole months come
+ * from the monthly rollup.
+ */
+class ColumnScan {
+public:
+    static ColumnTotals MaskedTotals(const double* amounts, const int32_t* days, const uint8_t* types, size_t rows,
+                                     int32_t firstDay, int32_t lastDay, int type);
+
+    /// @brief Kernel in use on this machine: "avx2", "sse2" or "scalar".
+    static const char* KernelName();
+};
+
+#endif // !ColumnScan_h
@@ -8,16 +8,30 @@
 #ifndef AppController_h
 #define AppController_h
 
+#include <cstdint>
 #include <string>
 #include <thread>
 #include <mutex>
 #include <atomic>
+#include <condition_variable>
 
 #include "Utils/ArrayList.h"
 #include "Utils/HashMap.h"
+#include "Utils/EntityId.h"
+#include "Utils/Region.h"
+#include "Utils/StringArena.h"
+#include "Utils/MemoryStats.h"
+#include "Utils/TrigramIndex.h"
+#include "Utils/BitmapIndex.h"
+#include "Utils/MonthlyRollup.h"
+#include "Utils/FenwickTree.h"
 #include "Utils/Date.h"
 #include "Utils/Enums.h"
 #include "Views/ConsoleView.h"
+#include "Models/Transaction.h"
+#include "Models/TransactionLedger.h"
+#include "Models/TransactionQuery.h"
+#include "Models/ReportCache.h"
 
 // Forward Declarations
 class Transaction;
@@ -26,12 +40,54 @@ class Wallet;
 class Category;
 class IncomeSource;
 
+/**
+ * @struct EntityUsage
+ * @brief How many records reference a wallet, category or income source.
+ * Maintained incrementally so restrict-delete checks and UI counts are O(1).
+ */
+struct EntityUsage {
+    size_t transactions;
+    size_t recurring;
+
+    size_t Total() const { return transactions + recurring; }
+};
+
+/**
+ * @struct WalletFlow
+ * @brief Money into (income) and out of (expense) a wallet over some days.
+ * Summable, so it can be the value of a FenwickTree.
+ */
+struct WalletFlow {
+    double income;
+    double expense;
+
+    WalletFlow() : income(0), expense(0) { }
+    WalletFlow(double i, double e) : income(i), expense(e) { }
+
+    double Net() const { return income - expense; }
+
+    WalletFlow& operator+=(const WalletFlow& other) { income += other.income; expense += other.expense; return *this; }
+    WalletFlow& operator-=(const WalletFlow& other) { income -= other.income; expense -= other.expense; return *this; }
+    WalletFlow operator-(const WalletFlow& other) const { return WalletFlow(income - other.income, expense - other.expense); }
+};
+
+/**
+ * @struct WalletStats
+ * @brief What the dashboard shows per wallet, read from maintained counters.
+ */
+struct WalletStats {
+    size_t transactions;
+    WalletFlow monthToDate; // From the 1st of the month to the given day
+};
+
 class AppController {
 private:
     // --- THREADING ---
     std::recursive_mutex dataMutex;
     std::thread autoSaveThread;
     std::atomic<bool> stopAutoSave;
+    std::mutex autoSaveMutex;
+    std::condition_variable autoSaveWake; // Signalled on shutdown, so the worker stops without finishing its wait
 
     void AutoSaveWorker();
     void ShowAutoSaveIndicator();
@@ -40,27 +96,80 @@ private:
     ConsoleView* view;
 
     // --- DATA STORAGE ---
-    ArrayList<Transaction*>* transactions;
+    Region<Transaction>* transactionStore; // Owns every Transaction; wiped in O(blocks)
+    StringArena* descriptions;             // Owns every transaction description (one load generation)
+    TransactionLedger* transactions;
+    TransactionAmountIndex* amountIndex; // Same records, ordered by amount
+    uint64_t nextSequence; // Next ledger sequence number (see TransactionOrder)
+    uint64_t dataGeneration; // Bumped when the ledger/index layout changes; guards TransactionViews
     ArrayList<RecurringTransaction*>* recurringTransactions;
     ArrayList<Wallet*>* walletsList;
     ArrayList<Category*>* categoriesList;
     ArrayList<IncomeSource*>* incomeSourcesList;
 
     // --- ID MAPS  ---
-    HashMap<std::string, Wallet*>* walletsMap;
-    HashMap<std::string, Category*>* categoriesMap;
-    HashMap<std::string, IncomeSource*>* incomeSourcesMap;
-    HashMap<std::string, Transaction*>* transactionsMap;
-    HashMap<std::string, RecurringTransaction*>* recurringTransactionsMap;
+    HashMap<EntityId, Wallet*>* walletsMap;
+    HashMap<EntityId, Category*>* categoriesMap;
+    HashMap<EntityId, IncomeSource*>* incomeSourcesMap;
+    HashMap<EntityId, Transaction*>* transactionsMap;
+    HashMap<EntityId, RecurringTransaction*>* recurringTransactionsMap;
 
     // --- FAST INDICES  ---
-    HashMap<std::string, ArrayList<Transaction*>*>* walletIndex;
-    HashMap<std::string, ArrayList<Transaction*>*>* categoryIndex;
-    HashMap<std::string, ArrayList<Transaction*>*>* incomeSourceIndex; // [MỚI] Index cho Income Source
+    // Each index list uses the ledger order, so a record is found and unlinked in O(log N)
+    HashMap<EntityId, TransactionLedger*>* walletIndex;
+    HashMap<EntityId, TransactionLedger*>* categoryIndex;
+    HashMap<EntityId, TransactionLedger*>* incomeSourceIndex; // [MỚI] Index cho Income Source
+
+    // --- ROW SLOTS ---
+    // Every live transaction holds a slot (row id), handed out in increasing
+    // order, so posting lists and bitmaps mostly append. A deleted, re-dated or
+    // re-described record leaves its old slot empty until the next rebuild;
+    // the bitmaps drop it at once, the trigram lists keep it until then.
+    ArrayList<Transaction*>* slots; // Slot -> transaction (nullptr = vacated)
+    ArrayList<double>* slotAmounts; // Slot -> amount, so bitmap totals never touch the records
+    size_t vacantSlots;
+    TrigramIndex* textIndex;
+
+    // Column bitmaps over slots (low-cardinality columns)
+    BitmapIndex<int>* typeRows;          // TransactionType
+    BitmapIndex<EntityId>* walletRows;
+    BitmapIndex<EntityId>* categoryRows; // Categories and sources (distinct ID prefixes)
+    BitmapIndex<int>* monthRows;         // year * 12 + month - 1
+    RoaringBitmap* planRows;             // Bitmap rows of the query being planned
+    bool planRowsExact;                  // ... and they are exactly its matches
+
+    // Count / amount per month x type x wallet x category, for whole-month totals
+    MonthlyRollup* rollup;
+    // Count / amount per day, one tree per TransactionType, for any date range
+    FenwickTree<QueryTotals>* dailyTotals[2];
+    // Wallet -> income and expense per day, for balances at past dates and month-to-date flows
+    HashMap<EntityId, FenwickTree<WalletFlow>*>* walletDailyFlow;
+    // Recent GroupBy / ComparePeriods results; a transaction change drops those over its month
+    ReportCache* reportCache;
+
+    // --- USAGE COUNTERS (wallet / category / source ID -> references) ---
+    HashMap<EntityId, EntityUsage>* usageCounts;
 
     // --- HELPERS ---
     void AddTransactionToIndex(Transaction* t);
     void RemoveTransactionFromIndex(Transaction* t);
+    void AssignSlot(Transaction* t);
+    void VacateSlot(Transaction* t);
+    void CompactSlots();
+    void AdjustUsage(const EntityId& key, int transactions, int recurring);
+    void TrackRecurringUsage(RecurringTransaction* rt, int delta);
+    void TrackTotals(Transaction* t, int delta);
+    void CompactDescriptions();
+    void LoadTransactions();
+    const TransactionLedger* ResolvePlan(const TransactionQuery& query, QueryPlan& plan);
+    bool SelectRows(const TransactionQuery& query, RoaringBitmap& rows, bool& exact, size_t minColumns);
+    void CollectGroups(const TransactionQuery& query, GroupKey key, bool extremes, TransactionGroups& groups);
+    bool CollectRollupGroups(const TransactionQuery& query, GroupKey key, TransactionGroups& groups);
+    bool CollectDailyGroups(const TransactionQuery& query, TransactionGroups& groups);
+    void CollectPeriods(const TransactionQuery& query, GroupKey key, const Date* starts, const Date* ends, size_t count,
+                        TransactionGroups* groups);
+    template <typename Visit>
+    void WalkPlan(const TransactionQuery& query, const QueryPlan& plan, const TransactionLedger* source, Visit visit);
 
 public:
     // 1. CONSTRUCTOR & DESTRUCTOR
@@ -81,6 +190,15 @@ public:
     ArrayList<Wallet*>* GetWalletsList() const { return walletsList; }
     double GetTotalBalance() const;
 
+    /**
+     * @brief Wallet balance at the end of 'date': the current balance less the
+     * net of every later transaction, from the wallet's daily sums. O(log days).
+     */
+    double GetWalletBalanceAt(const std::string& walletId, const Date& date);
+
+    /// @brief Transaction count and income / expense from the 1st of 'today's month to 'today'. O(log days).
+    WalletStats GetWalletStats(const std::string& walletId, const Date& today);
+
     // 4. CATEGORY MANAGEMENT
     void AddCategory(const std::string& name);
     Category* GetCategoryById(const std::string& id);
@@ -97,12 +215,21 @@ public:
     
     ArrayList<IncomeSource*>* GetIncomeSourcesList() const { return incomeSourcesList; }
 
+    /// @brief Transactions and recurring templates referencing a wallet, category or source. O(1).
+    EntityUsage GetUsage(const std::string& id);
+
     // 6. TRANSACTION CORE LOGIC
     void AddTransaction(double amount, std::string walletId, std::string categoryOrSourceId, TransactionType type, Date date, std::string description);
     bool DeleteTransaction(const std::string& transactionId);
     bool EditTransaction(const std::string& id, double newAmount, Date newDate, std::string newDesc);
     
-    ArrayList<Transaction*>* GetTransactions() const { return transactions; }
+    TransactionLedger* GetTransactions() const { return transactions; }
+
+    /// @brief Arena holding the descriptions of this controller's transactions.
+    const StringArena& GetDescriptions() const { return *descriptions; }
+    std::string GetDescription(const Transaction* t) const { return t->GetDescription(*descriptions); }
+
+    uint64_t GetDataGeneration() const { return dataGeneration; }
 
     // 7. AUTOMATION (Recurring)
     void AddRecurringTransaction(Frequency freq, Date startDate, Date endDate, std::string walletId, std::string categoryId, double amount, TransactionType type, std::string desc);
@@ -119,13 +246,73 @@ public:
     
     // --- ADVANCED FILTERS ---
     ArrayList<Transaction*>* GetTransactionsByAmountRange(double minAmount, double maxAmount);
-    ArrayList<Transaction*>* GetTransactionsByWallet(const std::string& walletId);
-    ArrayList<Transaction*>* GetTransactionsByCategory(const std::string& categoryId);
     
-
-    ArrayList<Transaction*>* GetTransactionsByIncomeSource(const std::string& sourceId);
+    // --- INDEX-BACKED VIEWS (no copy; valid until the next data change) ---
+    TransactionView GetTransactionsByWallet(const std::string& walletId);
+    TransactionView GetTransactionsByCategory(const std::string& categoryId);
+    TransactionView GetTransactionsByIncomeSource(const std::string& sourceId);
     
-    ArrayList<Transaction*>* SearchTransactions(const std::string& keyword);
+    /// @brief Descriptions containing 'keyword' anywhere, not only as a whole word ("read" finds "bread"),
+    /// plus the transaction whose ID is 'keyword', in ledger order.
+    ArrayList<Transaction*>* SearchTransactions(const std::string& keyword, bool ignoreCase = false);
+
+    /// @brief Descriptions containing 'text' with at most 'maxEdits' typos (case-insensitive).
+    ArrayList<Transaction*>* SearchTransactionsFuzzy(const std::string& text, int maxEdits);
+
+    // --- QUERY ENGINE ---
+    /// @brief Picks the smallest candidate slice (ledger, date seek or an index). O(log N + chunks).
+    QueryPlan PlanQuery(const TransactionQuery& query);
+
+    /// @brief Runs the query along its plan. Caller owns the returned list.
+    ArrayList<Transaction*>* RunQuery(const TransactionQuery& query);
+
+    /**
+     * @brief Match count and amount total. A date range and type alone are
+     * answered from the daily prefix sums in O(log days). Otherwise, without
+     * a limit, amount or text condition, whole months come from the monthly
+     * rollup and only partial edge months are read; failing that, when the
+     * column bitmaps answer the query exactly, the total comes from the slot
+     * amount column.
+     */
+    QueryTotals Aggregate(const TransactionQuery& query);
+
+    /**
+     * @brief Count, sum, min and max of the query's matches per 'key' value,
+     * in one walk of the planned slice. Sort and limit do not apply.
+     * Without 'extremes', min and max stay 0 and whole months may come from
+     * the monthly rollup (as in Aggregate). Results are cached until a
+     * transaction in a month of the query's date range changes, so repeat
+     * views are copies. Caller owns the returned groups.
+     */
+    TransactionGroups* GroupBy(const TransactionQuery& query, GroupKey key, bool extremes = true);
+
+    /**
+     * @brief Groups of the query's matches per 'key' value in each of 'count'
+     * periods [starts[i], ends[i]], into groups[i] (the query's own date
+     * range is ignored; periods may overlap). By type with no condition but
+     * the type, each period comes from the daily prefix sums in O(log days).
+     * Under type / wallet / category conditions only, the whole months of
+     * all periods come from one pass over the monthly rollup. The rest (the
+     * edge months, or every period otherwise) is walked once over the union,
+     * in date order, into segments cut at the period bounds; each period then
+     * merges the segments it covers. Min and max stay 0. Cached like GroupBy.
+     */
+    void ComparePeriods(const TransactionQuery& query, GroupKey key, const Date* starts, const Date* ends, size_t count,
+                        TransactionGroups* groups);
+
+    /**
+     * @brief Approximate amount quantiles of the query's matches per 'key'
+     * value: one walk of the planned slice feeding one fixed-size TDigest
+     * per group, so memory does not grow with the rows. Sort and limit do
+     * not apply. Caller owns the map and its digests (FreeMapValues).
+     * For the largest K matches, run the query sorted by descending amount
+     * with Limit(K): it keeps at most 2K rows.
+     */
+    AmountDigests* DigestBy(const TransactionQuery& query, GroupKey key);
+
+    // 9. DIAGNOSTICS
+    /// @brief Bytes, counts, load factors and chain lengths of every table and index.
+    MemoryReport GetMemoryReport();
 };
 
 #endif 
\ No newline at end of file
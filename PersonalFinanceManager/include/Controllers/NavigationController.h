@@ -7,6 +7,7 @@
 #include "Views/Menus.h"
 #include "Views/ConsoleView.h"
 #include "Views/InputValidator.h"
+#include "Models/TransactionLedger.h"
 
 // Forward Declaration
 class AppController;
@@ -73,6 +74,9 @@ private:
     void HandleIncomeVsExpense();
     void HandleWalletBalanceOverview();
     void HandleIncomeBySource();
+    void HandleMemoryUsage();
+    void HandleLargestExpenses();
+    void HandleSpendingPercentiles();
 
     // Recurring transaction handlers
     void ShowRecurringFlow();
@@ -89,7 +93,10 @@ private:
     void HandleFilterBySource();
     void HandleFilterByAmount();
     void HandleFilterByDate();
+    void HandleAdvancedSearch();
     void PrintTransactionList(ArrayList<Transaction*>* list);
+    void PrintTransactionList(const TransactionView& list);
+    void PrintTransactionRow(Transaction* t);
     
     // Clear data handlers
     void HandleClearData();
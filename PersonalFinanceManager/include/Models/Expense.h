@@ -13,18 +13,17 @@
 
 /**
  * @class Expense
- * @brief Represents money leaving a wallet.
- * Inherits from Transaction.
+ * @brief Compatibility factory for money leaving a wallet.
+ * Transaction is a single tagged value type; this only fixes the tag.
  */
-class Expense : public Transaction {
+class Expense {
 public:
+    Expense() = delete;
+    
     /**
-     * @brief Constructor for Expense.
-     * Automatically sets TransactionType to Expense.
+     * @brief Builds a Transaction with TransactionType::Expense.
      */
-    Expense(std::string id, std::string walletId, std::string catId, double amount, Date date, std::string desc);
-    
-    // Serialization: We use the Base Transaction::ToBinary and Transaction::FromBinary
+    static Transaction Create(StringArena& descriptions, std::string id, std::string walletId, std::string catId, double amount, Date date, std::string desc);
 };
 
 #endif // !Expense_h
@@ -13,18 +13,17 @@
 
 /**
  * @class Income
- * @brief Represents money coming into a wallet.
- * Inherits from Transaction.
+ * @brief Compatibility factory for money coming into a wallet.
+ * Transaction is a single tagged value type; this only fixes the tag.
  */
-class Income : public Transaction {
+class Income {
 public:
+    Income() = delete;
+    
     /**
-     * @brief Constructor for Income.
-     * Automatically sets TransactionType to Income.
+     * @brief Builds a Transaction with TransactionType::Income.
      */
-    Income(std::string id, std::string walletId, std::string catId, double amount, Date date, std::string desc);
-    
-    // Serialization: We use the Base Transaction::ToBinary and Transaction::FromBinary
+    static Transaction Create(StringArena& descriptions, std::string id, std::string walletId, std::string catId, double amount, Date date, std::string desc);
 };
 
 #endif // !Income_h
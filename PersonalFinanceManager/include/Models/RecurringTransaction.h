@@ -14,6 +14,8 @@
 #include <fstream>
 #include <string>
 
+class Transaction;
+
 /**
  * @class RecurringTransaction
  * @brief A template for generating transactions automatically over time.
@@ -92,9 +94,9 @@ public:
      * @brief Creates a new concrete Transaction object based on this template.
      * @param newTransId The ID for the new transaction.
      * @param dateToCreate The date for the new transaction.
-     * @return Pointer to a new Income or Expense object (Caller owns memory).
+     * @return The new Transaction by value (the caller decides where it is stored).
      */
-    Transaction* GenerateTransaction(std::string newTransId, const Date& dateToCreate);
+    Transaction GenerateTransaction(StringArena& descriptions, std::string newTransId, const Date& dateToCreate);
     
     /**
      * @brief Checks if a new transaction needs to be generated for the given date.
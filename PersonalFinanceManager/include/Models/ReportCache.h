@@ -0,0 +1,95 @@
+//
+//  ReportCache.h
+//  PersonalFinanceManager
+//
+
+#ifndef ReportCache_h
+#define ReportCache_h
+
+#include "Utils/ArrayList.h"
+#include "Models/TransactionQuery.h"
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @class ReportCache
+ * @brief Recent report results (one or more TransactionGroups), keyed by
+ * report kind and parameters, each tagged with the months it depends on.
+ *
+ * A change to a transaction drops only the results whose month range holds
+ * the transaction's month, so reports over other periods stay cached. The
+ * cache holds a few results and evicts the least recently used one when full;
+ * results are copied in and out, so callers never hold a cached pointer.
+ */
+class ReportCache {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 32;
+
+    /// Month range of a result that depends on every month (no date range).
+    static constexpr int ALL_MONTHS_FIRST = INT_MIN;
+    static constexpr int ALL_MONTHS_LAST = INT_MAX;
+
+private:
+    struct Entry {
+        std::string key;
+        int firstMonth;           // Months (year * 12 + month - 1) the result depends on
+        int lastMonth;
+        TransactionGroups* groups; // 'count' result groups
+        size_t count;
+        uint64_t lastUse;
+    };
+
+    ArrayList<Entry*> entries; // Few entries: lookups compare keys in turn
+    size_t capacity;
+    uint64_t clock;
+    size_t hits;
+    size_t misses;
+    size_t dropped;
+
+    static void Copy(const TransactionGroups& from, TransactionGroups& to);
+    void Release(size_t index);
+
+public:
+    // ==========================================
+    // 1. CONSTRUCTOR & DESTRUCTOR
+    // ==========================================
+    explicit ReportCache(size_t capacity = DEFAULT_CAPACITY);
+    ~ReportCache();
+
+    ReportCache(const ReportCache&) = delete;
+    ReportCache& operator=(const ReportCache&) = delete;
+
+    // ==========================================
+    // 2. LOOKUP & STORE
+    // ==========================================
+
+    /// @brief Copies the 'count' cached groups of 'key' into 'groups' (empty maps); false on a miss.
+    bool Lookup(const std::string& key, TransactionGroups* groups, size_t count);
+
+    /// @brief Caches a copy of 'count' groups, valid until a month in [firstMonth, lastMonth] changes.
+    void Store(const std::string& key, int firstMonth, int lastMonth, const TransactionGroups* groups, size_t count);
+
+    // ==========================================
+    // 3. INVALIDATION
+    // ==========================================
+
+    /// @brief Drops every result depending on 'month'. O(entries).
+    void Invalidate(int month);
+
+    void Clear();
+
+    // ==========================================
+    // 4. DIAGNOSTICS
+    // ==========================================
+    size_t Count() const { return entries.Count(); }
+    size_t Capacity() const { return capacity; }
+    size_t Hits() const { return hits; }
+    size_t Misses() const { return misses; }
+    size_t Dropped() const { return dropped; }
+    size_t BytesReserved() const;
+};
+
+#endif // !ReportCache_h
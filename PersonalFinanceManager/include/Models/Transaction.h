@@ -10,28 +10,39 @@
 
 #include "Utils/Date.h"
 #include "Utils/Enums.h"
+#include "Utils/EntityId.h"
+#include "Utils/StringArena.h"
 #include "Utils/BinaryFileHelper.h"
 
+#include <cstdint>
 #include <fstream>
 #include <string>
+#include <string_view>
+#include <type_traits>
 
 
 /**
  * @class Transaction
- * @brief Base class representing a single financial record.
+ * @brief A single financial record (Income or Expense).
  *
- * This abstract class holds common data shared by both Income and Expense,
- * such as amount, date, description, and the associated wallet.
+ * A final, non-virtual value type: Income and Expense are distinguished only
+ * by the TransactionType tag, so there is no vtable and transactions can be
+ * stored by value. IDs are kept inline as EntityId and the description lives
+ * in a StringArena owned by whoever owns the record (AppController), which
+ * makes the record trivially copyable. The record keeps only the offset and
+ * length, so every description accessor takes that arena.
  */
-class Transaction {
-protected:
-    std::string id;
-    std::string walletId;
-    std::string categoryId; // categoryId and sourceId
+class Transaction final {
+private:
+    EntityId id;
+    EntityId walletId;
+    EntityId categoryId; // categoryId and sourceId
     double amount;
-    std::string description;
     Date date;
     TransactionType type;
+    StringRef description; // Offset/length into the owner's description arena
+    uint64_t sequence;     // Ledger tie-breaker for equal dates (not persisted)
+    uint32_t slot;         // Row id in the trigram index and column bitmaps (not persisted)
     
 public:
     // ==========================================
@@ -47,11 +58,9 @@ public:
      * @param amount The monetary value.
      * @param type Enum indicating Income or Expense.
      * @param date Date of the transaction.
-     * @param desc Short description.
+     * @param desc Short description, appended to 'descriptions'.
      */
-    Transaction(std::string id, std::string walletId, std::string catId, double amount, TransactionType type, Date date, std::string desc);
-    
-    virtual ~Transaction() = default;
+    Transaction(StringArena& descriptions, std::string id, std::string walletId, std::string catId, double amount, TransactionType type, Date date, std::string desc);
     
     // ==========================================
     // 2. GETTERS (ACCESSORS)
@@ -62,7 +71,30 @@ public:
     double GetAmount() const;
     Date GetDate() const;
     TransactionType GetType() const;
-    std::string GetDescription() const;
+    std::string GetDescription(const StringArena& descriptions) const;
+    
+    /// @brief The description bytes in the arena; valid until the arena grows or is compacted.
+    std::string_view GetDescriptionView(const StringArena& descriptions) const;
+
+    /// @brief Substring test against the arena bytes (no string copy).
+    bool DescriptionContains(const StringArena& descriptions, const std::string& needle, bool ignoreCase = false) const;
+
+    /// @brief Where the description sits in its arena.
+    StringRef GetDescriptionRef() const { return description; }
+
+    /// @brief Substring test allowing 'maxEdits' typos, ignoring ASCII case (see TrigramIndex).
+    bool DescriptionResembles(const StringArena& descriptions, const std::string& pattern, int maxEdits) const;
+    
+    /// @brief Inline keys for HashMap lookups (no string copy).
+    const EntityId& GetIdKey() const { return id; }
+    const EntityId& GetWalletKey() const { return walletId; }
+    const EntityId& GetCategoryKey() const { return categoryId; }
+    
+    /// @brief Position among same-date records, assigned by AppController.
+    uint64_t GetSequence() const { return sequence; }
+    
+    /// @brief Search-index id, assigned by AppController.
+    uint32_t GetSlot() const { return slot; }
     
     // ==========================================
     // 3. SETTERS (MUTATORS)
@@ -70,8 +102,20 @@ public:
     void SetAmount(double a);
     void SetWalletId(const std::string& w);
     void SetCategoryId(const std::string& c);
-    void SetDescription(const std::string& d);
+    void SetDescription(StringArena& descriptions, const std::string& d);
     void SetDate(const Date& d);
+    void SetSequence(uint64_t s) { sequence = s; }
+    void SetSlot(uint32_t s) { slot = s; }
+    
+    // ==========================================
+    // 3.1. DESCRIPTION STORAGE
+    // ==========================================
+    
+    /// @brief Marks this record's description dead (call before discarding it).
+    void ReleaseDescription(StringArena& descriptions);
+    
+    /// @brief Copies the description from its arena into another one (used by compaction).
+    void MoveDescription(const StringArena& from, StringArena& to);
     
     // ==========================================
     // 4. DISPLAY & SERIALIZATION
@@ -80,7 +124,7 @@ public:
      * @brief Returns a string representation of the transaction.
      * Useful for debugging or console output.
      */
-    virtual std::string ToString() const;
+    std::string ToString(const StringArena& descriptions) const;
     
     // ==========================================
     // 5. SERIALIZATION
@@ -90,13 +134,41 @@ public:
      * @brief Serializes the object to a binary stream.
      * Order: Type -> ID -> WalletID -> CategoryID -> amount -> date -> description
      */
-    virtual void ToBinary(std::ofstream& fout) const;
+    void ToBinary(std::ofstream& fout, const StringArena& descriptions) const;
 
     /**
      * @brief Factory method to create a Transaction from a binary stream.
-     * Reads in the same order as ToBinary.
+     * Reads in the same order as ToBinary, the description straight into
+     * 'descriptions'. Returns by value; the caller decides where the record is stored.
      */
-    static Transaction* FromBinary(std::ifstream& fin);
+    static Transaction FromBinary(std::ifstream& fin, StringArena& descriptions);
+};
+
+static_assert(std::is_trivially_copyable<Transaction>::value, "Transaction must stay memcpy-able");
+
+/**
+ * @struct TransactionOrder
+ * @brief Ledger order: by date, then by sequence (insertion order).
+ * Unique per record, so sorted containers can locate an exact transaction.
+ */
+struct TransactionOrder {
+    bool operator()(const Transaction* a, const Transaction* b) const {
+        Date da = a->GetDate(), db = b->GetDate();
+        if (da != db) return da < db;
+        return a->GetSequence() < b->GetSequence();
+    }
+};
+
+/**
+ * @struct TransactionAmountOrder
+ * @brief Amount order; equal amounts fall back to ledger order, so it is unique too.
+ */
+struct TransactionAmountOrder {
+    bool operator()(const Transaction* a, const Transaction* b) const {
+        double ma = a->GetAmount(), mb = b->GetAmount();
+        if (ma != mb) return ma < mb;
+        return TransactionOrder()(a, b);
+    }
 };
 
 #endif // !Transaction_h
@@ -0,0 +1,60 @@
+//
+//  TransactionLedger.h
+//  PersonalFinanceManager
+//
+
+#ifndef TransactionLedger_h
+#define TransactionLedger_h
+
+#include "Utils/SortedChunkList.h"
+#include "Models/Transaction.h"
+
+#include <cstdint>
+#include <stdexcept>
+
+/// Transactions in (date, sequence) order: the master ledger and every per-wallet/category index.
+using TransactionLedger = SortedChunkList<Transaction*, TransactionOrder>;
+
+/// Every transaction in (amount, date, sequence) order, for amount ranges and top-N.
+using TransactionAmountIndex = SortedChunkList<Transaction*, TransactionAmountOrder>;
+
+/**
+ * @class TransactionView
+ * @brief Read-only, non-owning window onto a ledger or index list.
+ *
+ * Obtaining a view copies nothing and allocates nothing. The view records
+ * the controller's data generation when it was taken; any later change to
+ * the transactions bumps that counter, and touching a stale view throws
+ * std::logic_error instead of reading a list that may have been freed.
+ * Take a fresh view after modifying data.
+ */
+class TransactionView {
+private:
+    const TransactionLedger* list;      // nullptr = empty result
+    const uint64_t* liveGeneration;
+    uint64_t generation;
+
+    const TransactionLedger* Checked() const {
+        if (!IsValid()) throw std::logic_error("TransactionView used after the data changed");
+        return list;
+    }
+
+public:
+    TransactionView(const TransactionLedger* l, const uint64_t* live)
+        : list(l), liveGeneration(live), generation(*live) { }
+
+    /// @brief False once the underlying transactions have been modified.
+    bool IsValid() const { return *liveGeneration == generation; }
+
+    size_t Count() const { return Checked() ? list->Count() : 0; }
+    bool IsEmpty() const { return Count() == 0; }
+
+    TransactionLedger::Iterator begin() const {
+        return Checked() ? list->begin() : TransactionLedger::Iterator(nullptr, 0);
+    }
+    TransactionLedger::Iterator end() const {
+        return Checked() ? list->end() : TransactionLedger::Iterator(nullptr, 0);
+    }
+};
+
+#endif // !TransactionLedger_h
@@ -0,0 +1,281 @@
+//
+//  TransactionQuery.h
+//  PersonalFinanceManager
+//
+
+#ifndef TransactionQuery_h
+#define TransactionQuery_h
+
+#include "Utils/Date.h"
+#include "Utils/Enums.h"
+#include "Utils/EntityId.h"
+#include "Utils/FlatHashMap.h"
+#include "Utils/TDigest.h"
+#include "Utils/StringArena.h"
+
+#include <cstddef>
+#include <string>
+
+class Transaction;
+
+/// Result order of a TransactionQuery. Ties keep ledger order.
+enum class QuerySort {
+    DateAscending,
+    DateDescending,
+    AmountAscending,
+    AmountDescending
+};
+
+/**
+ * @class TransactionQuery
+ * @brief Builder for a multi-condition transaction search.
+ *
+ * Every condition is optional and they are ANDed together:
+ * @code
+ *   TransactionQuery().InDateRange(start, end).InWallet(id).InAmountRange(10, 500)
+ *                     .Containing("coffee").SortBy(QuerySort::AmountDescending).Limit(20);
+ * @endcode
+ * The query only describes the search; AppController::PlanQuery picks the
+ * access path and AppController::RunQuery executes it.
+ */
+class TransactionQuery {
+private:
+    bool hasDateRange;
+    Date startDate;
+    Date endDate;
+
+    bool hasAmountRange;
+    double minAmount;
+    double maxAmount;
+
+    bool hasType;
+    TransactionType type;
+
+    bool hasWallet;
+    EntityId walletKey;   // Empty when the ID was malformed: then nothing matches
+
+    bool hasCategory;
+    EntityId categoryKey; // Category (Expense) or Source (Income)
+
+    bool hasKeyword;
+    std::string keyword;  // Description substring
+    bool keywordIgnoresCase;
+
+    bool hasFuzzyText;
+    std::string fuzzyText; // Description substring allowing typos (case-insensitive)
+    int maxEdits;
+
+    QuerySort sort;
+    size_t limit;         // 0 = unlimited
+
+public:
+    // ==========================================
+    // 1. CONSTRUCTOR
+    // ==========================================
+    TransactionQuery();
+
+    // ==========================================
+    // 2. BUILDER (each call returns *this)
+    // ==========================================
+    TransactionQuery& InDateRange(const Date& start, const Date& end);
+    TransactionQuery& InAmountRange(double min, double max);
+    TransactionQuery& OfType(TransactionType t);
+    TransactionQuery& InWallet(const std::string& walletId);
+
+    /// @brief Expenses in a category (also restricts the type to Expense).
+    TransactionQuery& InCategory(const std::string& categoryId);
+
+    /// @brief Incomes from a source (also restricts the type to Income).
+    TransactionQuery& FromSource(const std::string& sourceId);
+
+    /// @brief Description contains 'text' as a substring (optionally ignoring ASCII case).
+    TransactionQuery& Containing(const std::string& text, bool ignoreCase = false);
+
+    /**
+     * @brief Description contains 'text' with at most 'edits' typos (inserted,
+     * deleted or replaced bytes), ignoring ASCII case. 'edits' is clamped to
+     * [0, TrigramIndex::MAX_EDITS] and 'text' to TrigramIndex::MAX_FUZZY_LENGTH bytes.
+     */
+    TransactionQuery& Resembling(const std::string& text, int edits);
+
+    TransactionQuery& SortBy(QuerySort order);
+    TransactionQuery& Limit(size_t maxResults);
+
+    // ==========================================
+    // 3. ACCESSORS (used by the planner)
+    // ==========================================
+    bool HasDateRange() const { return hasDateRange; }
+    const Date& GetStartDate() const { return startDate; }
+    const Date& GetEndDate() const { return endDate; }
+
+    bool HasAmountRange() const { return hasAmountRange; }
+    double GetMinAmount() const { return minAmount; }
+    double GetMaxAmount() const { return maxAmount; }
+
+    bool HasKeyword() const { return hasKeyword; }
+    const std::string& GetKeyword() const { return keyword; }
+    bool KeywordIgnoresCase() const { return keywordIgnoresCase; }
+
+    bool HasFuzzyText() const { return hasFuzzyText; }
+    const std::string& GetFuzzyText() const { return fuzzyText; }
+    int GetMaxEdits() const { return maxEdits; }
+
+    bool HasType() const { return hasType; }
+    TransactionType GetType() const { return type; }
+
+    bool HasWallet() const { return hasWallet; }
+    const EntityId& GetWalletKey() const { return walletKey; }
+
+    bool HasCategory() const { return hasCategory; }
+    const EntityId& GetCategoryKey() const { return categoryKey; }
+
+    QuerySort GetSort() const { return sort; }
+    size_t GetLimit() const { return limit; }
+
+    // ==========================================
+    // 4. EVALUATION
+    // ==========================================
+
+    /**
+     * @brief True if the transaction satisfies every condition.
+     * Cheap field compares run first; the description scans run last.
+     * 'keywordChecked' skips the keyword test when the caller has already proven it.
+     * 'descriptions' is the arena holding the transaction's description.
+     */
+    bool Matches(const Transaction* t, const StringArena& descriptions, bool keywordChecked = false) const;
+
+    /// @brief The conditions packed into a string (equal for equal conditions), for
+    /// result caches. Sort and limit are left out.
+    std::string ConditionKey() const;
+};
+
+/**
+ * @struct QueryPlan
+ * @brief Access path chosen for a TransactionQuery, with its row estimate.
+ *
+ * The ledger and the wallet/category/source indexes are in ledger order, so
+ * a date range is a binary-searched slice of whichever list is chosen; the
+ * amount index is sliced by the amount range instead, a description
+ * search can start from the trigram index's candidates, and two or more
+ * type / wallet / category / month conditions can start from the
+ * intersection of their column bitmaps. The plan walks the smallest slice
+ * and checks the remaining conditions row by row; no intermediate lists of
+ * records are built. When the walk order already matches the requested
+ * sort ('ordered'), a limit ends the walk early.
+ */
+struct QueryPlan {
+    enum class Path {
+        Empty,          // An index lookup proved there are no matches
+        Ledger,         // Master ledger
+        WalletIndex,
+        CategoryIndex,
+        SourceIndex,
+        AmountIndex,
+        TrigramIndex,   // Description search candidates, verified row by row
+        Bitmap          // Intersection of the type / wallet / category / month bitmaps
+    };
+
+    Path path;
+    bool dateSeek;        // Slice a ledger-ordered list by the date range
+    bool amountSeek;      // Slice the amount index by the amount range
+    bool ordered;         // Walk order is the result order
+    bool backward;        // Walk the slice from its end (descending sorts)
+    bool fuzzy;           // Trigram candidates come from the fuzzy text, not the keyword
+    bool exact;           // Bitmap rows are exactly the matches (nothing left to check)
+    size_t candidateRows; // Rows the scan will visit at most (exact)
+    size_t totalRows;     // Rows in the ledger
+
+    QueryPlan()
+        : path(Path::Empty), dateSeek(false), amountSeek(false), ordered(false), backward(false),
+          fuzzy(false), exact(false), candidateRows(0), totalRows(0) { }
+
+    /// @brief One-line summary, e.g. "wallet index + date seek: 120 of 50,000 rows".
+    std::string Describe() const;
+};
+
+/**
+ * @struct QueryTotals
+ * @brief How many transactions match a query and their amount total.
+ * Summable, so it can also be the value of a FenwickTree.
+ */
+struct QueryTotals {
+    size_t count;
+    double amount;
+
+    QueryTotals() : count(0), amount(0) { }
+    QueryTotals(size_t c, double a) : count(c), amount(a) { }
+
+    QueryTotals& operator+=(const QueryTotals& other) { count += other.count; amount += other.amount; return *this; }
+    QueryTotals& operator-=(const QueryTotals& other) { count -= other.count; amount -= other.amount; return *this; }
+    QueryTotals operator-(const QueryTotals& other) const { return QueryTotals(count - other.count, amount - other.amount); }
+};
+
+/// Column AppController::GroupBy splits a query's matches by.
+enum class GroupKey {
+    Type,
+    Wallet,
+    Category, // Category (Expense) or Source (Income)
+    Month     // year * 12 + month - 1
+};
+
+/**
+ * @struct GroupValue
+ * @brief One group of a GroupBy: an ID (wallet, category, source) or a number (type, month).
+ */
+struct GroupValue {
+    EntityId id;
+    int number;
+
+    GroupValue() : id(), number(0) { }
+    static GroupValue Of(const std::string& entityId) { GroupValue g; g.id = EntityId::FromString(entityId); return g; }
+    static GroupValue Of(const EntityId& entityId) { GroupValue g; g.id = entityId; return g; }
+    static GroupValue Of(int value) { GroupValue g; g.number = value; return g; }
+    static GroupValue Of(TransactionType t) { return Of(static_cast<int>(t)); }
+    static GroupValue OfMonth(int month, int year) { return Of(year * 12 + month - 1); }
+
+    unsigned long hash() const { return id.hash() ^ static_cast<unsigned long>(number); }
+    bool operator==(const GroupValue& other) const { return number == other.number && id == other.id; }
+};
+
+/**
+ * @struct GroupTotals
+ * @brief Count, sum and extremes of the amounts in one group.
+ */
+struct GroupTotals {
+    size_t count;
+    double sum;
+    double min;
+    double max;
+
+    GroupTotals() : count(0), sum(0), min(0), max(0) { }
+
+    void Add(double amount) {
+        if (count == 0 || amount < min) min = amount;
+        if (count == 0 || amount > max) max = amount;
+        sum += amount;
+        ++count;
+    }
+
+    /// @brief Adds rows whose extremes are not known (min and max are left as they are).
+    void Merge(size_t rows, double amount) {
+        count += rows;
+        sum += amount;
+    }
+
+    /// @brief Adds rows with known extremes.
+    void Merge(size_t rows, double amount, double low, double high) {
+        if (rows == 0) return;
+        if (count == 0 || low < min) min = low;
+        if (count == 0 || high > max) max = high;
+        count += rows;
+        sum += amount;
+    }
+};
+
+/// Groups of one GroupBy pass, looked up with GroupValue::Of(...).
+typedef FlatHashMap<GroupValue, GroupTotals> TransactionGroups;
+
+/// Amount digest per group of one DigestBy pass (owned; free with AppHelpers::FreeMapValues).
+typedef FlatHashMap<GroupValue, TDigest*> AmountDigests;
+
+#endif // !TransactionQuery_h
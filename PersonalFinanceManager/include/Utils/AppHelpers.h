@@ -11,8 +11,12 @@
 #include <string>
 #include <fstream>
 #include "Models/Transaction.h"
+#include "Models/TransactionLedger.h"
 #include "Utils/ArrayList.h"
 #include "Utils/HashMap.h"
+#include "Utils/FlatHashMap.h"
+#include "Utils/EntityId.h"
+#include "Utils/Region.h"
 #include "Utils/BinaryFileHelper.h"
 
 namespace AppHelpers {
@@ -24,17 +28,14 @@ bool IsStringEmptyOrWhitespace(const std::string& str);
 // ==========================================
 bool CompareTransactionsByDate(Transaction* const& a, Transaction* const& b);
 
-    // Binary Search to find insertion point (Keep list sorted)
-size_t GetSortedInsertIndex(ArrayList<Transaction*>* list, Date date);
-
 // ==========================================
 // 3. MEMORY MANAGEMENT UTILS
 // ==========================================
 
-// Specific cleanup for Index Maps (Value is ArrayList<Transaction*>*)
-void ClearIndexMap(HashMap<std::string, ArrayList<Transaction*>*>* indexMap);
-void AddToIndexMap(HashMap<std::string, ArrayList<Transaction*>*>* indexMap, const std::string& key, Transaction* t);
-void RemoveFromIndexMap(HashMap<std::string, ArrayList<Transaction*>*>* indexMap, const std::string& key, Transaction* t);
+// Specific cleanup for Index Maps (Value is TransactionLedger*)
+void ClearIndexMap(HashMap<EntityId, TransactionLedger*>* indexMap);
+void AddToIndexMap(HashMap<EntityId, TransactionLedger*>* indexMap, const EntityId& key, Transaction* t);
+void RemoveFromIndexMap(HashMap<EntityId, TransactionLedger*>* indexMap, const EntityId& key, Transaction* t);
 
 // Generic cleanup for any ArrayList of Pointers
 template <typename T>
@@ -48,12 +49,28 @@ void FreeList(ArrayList<T*>*& list) {
     }
 }
 
+// Deletes every value of a map of owned pointers and empties it (the map itself stays)
+template <typename K, typename V>
+void FreeMapValues(HashMap<K, V*>* map) {
+    ArrayList<V*> owned = map->Values();
+    for (size_t i = 0; i < owned.Count(); ++i) {
+        delete owned[i];
+    }
+    map->Clear();
+}
+
+template <typename K, typename V>
+void FreeMapValues(FlatHashMap<K, V*>* map) {
+    map->ForEach([](const K&, V* value) { delete value; });
+    map->Clear();
+}
+
 // ==========================================
 // 4. FILE I/O UTILS (TEMPLATES)
 // ==========================================
 
-template <typename T>
-void SaveTable(const std::string& filename, ArrayList<T*>* list) {
+template <typename List>
+void SaveTable(const std::string& filename, const List* list) {
     std::ofstream fout(filename, std::ios::binary);
     if (fout.is_open()) {
         BinaryFileHelper::WriteList(fout, list);
@@ -61,8 +78,23 @@ void SaveTable(const std::string& filename, ArrayList<T*>* list) {
     }
 }
 
+/// @brief SaveTable for records whose ToBinary() needs their owner's storage (e.g. a description arena).
+template <typename List, typename Context>
+void SaveTable(const std::string& filename, const List* list, const Context& context) {
+    std::ofstream fout(filename, std::ios::binary);
+    if (fout.is_open()) {
+        BinaryFileHelper::WriteList(fout, list, context);
+        fout.close();
+    }
+}
+
+/// @brief ID map key for a loaded object (Transaction already stores its key inline).
 template <typename T>
-void LoadTable(const std::string& filename, ArrayList<T*>* list, HashMap<std::string, T*>* map) {
+EntityId KeyOf(const T* obj) { return EntityId::FromString(obj->GetId()); }
+inline EntityId KeyOf(const Transaction* t) { return t->GetIdKey(); }
+
+template <typename T>
+void LoadTable(const std::string& filename, ArrayList<T*>* list, HashMap<EntityId, T*>* map) {
     std::ifstream fin(filename, std::ios::binary);
     if (fin.is_open()) {
         BinaryFileHelper::ReadList(fin, list);
@@ -71,7 +103,22 @@ void LoadTable(const std::string& filename, ArrayList<T*>* list, HashMap<std::st
         // Re-populate the ID Map
         for (size_t i = 0; i < list->Count(); ++i) {
             T* obj = list->Get(i);
-            map->Put(obj->GetId(), obj);
+            map->Put(KeyOf(obj), obj);
+        }
+    }
+}
+
+/// @brief LoadTable for value-type records owned by a Region ('context' goes to FromBinary).
+template <typename T, typename Context>
+void LoadTable(const std::string& filename, ArrayList<T*>* list, HashMap<EntityId, T*>* map, Region<T>* region, Context& context) {
+    std::ifstream fin(filename, std::ios::binary);
+    if (fin.is_open()) {
+        BinaryFileHelper::ReadList(fin, list, region, context);
+        fin.close();
+        
+        for (size_t i = 0; i < list->Count(); ++i) {
+            T* obj = list->Get(i);
+            map->Put(KeyOf(obj), obj);
         }
     }
 }
@@ -91,6 +138,20 @@ ArrayList<T*>* Filter(ArrayList<T*>* source, Predicate predicate) {
     return result;
 }
 
+template <typename T, typename Less, typename Predicate>
+ArrayList<T*>* Filter(const SortedChunkList<T*, Less>* source, Predicate predicate) {
+    ArrayList<T*>* result = new ArrayList<T*>();
+    
+    if (source) {
+        for (T* item : *source) {
+            if (predicate(item)) {
+                result->Add(item);
+            }
+        }
+    }
+    return result;
+}
+
 }
 
 #endif /* AppHelpers_h */
@@ -125,6 +125,11 @@ public:
     
     size_t Count() const { return size; }
     
+    size_t Capacity() const { return capacity; }
+    
+    /// @brief Heap bytes held by the backing array (used + spare slots).
+    size_t BytesReserved() const { return capacity * sizeof(T); }
+    
     bool IsEmpty() const { return size == 0; }
     
     T Get(size_t index) const {
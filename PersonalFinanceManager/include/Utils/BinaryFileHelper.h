@@ -10,6 +10,8 @@
 
 #include "Date.h"
 #include "ArrayList.h"
+#include "EntityId.h"
+#include "Region.h"
 
 #include <iostream>
 #include <fstream>
@@ -30,14 +32,25 @@ public:
     static void WriteString(std::ofstream& fout, const std::string& value);
     /// Write Date in format: [Day (int)] + [Month (int)] + [Year (int)]
     static void WriteDate(std::ofstream& fout, const Date& value);
+    /// Write EntityId in the same format as WriteString
+    static void WriteEntityId(std::ofstream& fout, const EntityId& value);
     
-    /// @brief Writes an entire ArrayList to binary. Assumes T has ToBinary().
-    template <typename T>
-    static void WriteList(std::ofstream& fout, ArrayList<T*>* list) {
+    /// @brief Writes a whole list of pointers (ArrayList, SortedChunkList) to binary. Assumes T has ToBinary().
+    template <typename List>
+    static void WriteList(std::ofstream& fout, const List* list) {
+        size_t count = list->Count();
+        BinaryFileHelper::Write<size_t>(fout, count);
+        for (const auto& item : *list)
+            item->ToBinary(fout);
+    }
+
+    /// @brief WriteList for records whose ToBinary() needs their owner's storage (e.g. a description arena).
+    template <typename List, typename Context>
+    static void WriteList(std::ofstream& fout, const List* list, const Context& context) {
         size_t count = list->Count();
         BinaryFileHelper::Write<size_t>(fout, count);
-        for (size_t i = 0; i < count; ++i)
-            list->Get(i)->ToBinary(fout);
+        for (const auto& item : *list)
+            item->ToBinary(fout, context);
     }
     
     // ==========================================
@@ -55,6 +68,9 @@ public:
     static std::string ReadString(std::ifstream& fin);
     /// Read Date in format: [Day (int)] + [Month (int)] + [Year (int)]
     static Date ReadDate(std::ifstream& fin);
+    /// Read a string written by WriteString/WriteEntityId straight into an EntityId (no heap).
+    /// Throws std::runtime_error when it is longer than EntityId::CAPACITY.
+    static EntityId ReadEntityId(std::ifstream& fin);
     
     /// @brief Reads an entire ArrayList from binary. Assumes T has FromBinary().
     template <typename T>
@@ -65,6 +81,15 @@ public:
             list->Add(object);
         }
     }
+    
+    /// @brief Reads value-type records (T FromBinary(fin, context)) into a Region, listing their addresses.
+    template <typename T, typename Context>
+    static void ReadList(std::ifstream& fin, ArrayList<T*>* list, Region<T>* region, Context& context) {
+        size_t count = BinaryFileHelper::Read<size_t>(fin);
+        for (size_t i = 0; i < count; ++i) {
+            list->Add(region->Allocate(T::FromBinary(fin, context)));
+        }
+    }
 };
 
 #endif // !BinaryFileHelper_h
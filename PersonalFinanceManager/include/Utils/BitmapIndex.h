@@ -0,0 +1,85 @@
+//
+//  BitmapIndex.h
+//  PersonalFinanceManager
+//
+
+#ifndef BitmapIndex_h
+#define BitmapIndex_h
+
+#include "ArrayList.h"
+#include "HashMap.h"
+#include "RoaringBitmap.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class BitmapIndex
+ * @brief One RoaringBitmap of row ids per distinct value of a column.
+ *
+ * Meant for low-cardinality columns (type, wallet, category, month), where
+ * each value covers many rows and conditions on several columns combine
+ * by intersecting their bitmaps.
+ *
+ * @tparam K Column value (needs a HashMap hasher).
+ */
+template <typename K>
+class BitmapIndex {
+private:
+    HashMap<K, RoaringBitmap*>* bitmaps;
+
+public:
+    BitmapIndex() : bitmaps(new HashMap<K, RoaringBitmap*>()) { }
+
+    ~BitmapIndex() {
+        Clear();
+        delete bitmaps;
+    }
+
+    BitmapIndex(const BitmapIndex&) = delete;
+    BitmapIndex& operator=(const BitmapIndex&) = delete;
+
+    void Add(const K& value, uint32_t row) {
+        RoaringBitmap*& rows = (*bitmaps)[value];
+        if (rows == nullptr) rows = new RoaringBitmap();
+        rows->Add(row);
+    }
+
+    void Remove(const K& value, uint32_t row) {
+        RoaringBitmap** rows = bitmaps->Get(value);
+        if (rows != nullptr) (*rows)->Remove(row);
+    }
+
+    /// @brief Rows holding 'value', or nullptr if none ever did.
+    const RoaringBitmap* Get(const K& value) const {
+        RoaringBitmap** rows = bitmaps->Get(value);
+        return (rows != nullptr) ? *rows : nullptr;
+    }
+
+    void Clear() {
+        ArrayList<RoaringBitmap*> owned = bitmaps->Values();
+        for (size_t i = 0; i < owned.Count(); ++i) delete owned[i];
+        bitmaps->Clear();
+    }
+
+    // ==========================================
+    // DIAGNOSTICS
+    // ==========================================
+    size_t ValueCount() const { return bitmaps->Count(); }
+
+    size_t RowCount() const {
+        size_t rows = 0;
+        ArrayList<RoaringBitmap*> owned = bitmaps->Values();
+        for (size_t i = 0; i < owned.Count(); ++i) rows += owned[i]->Count();
+        return rows;
+    }
+
+    size_t BytesReserved() const {
+        size_t bytes = bitmaps->BytesReserved();
+        ArrayList<RoaringBitmap*> owned = bitmaps->Values();
+        for (size_t i = 0; i < owned.Count(); ++i) bytes += sizeof(RoaringBitmap) + owned[i]->BytesReserved();
+        return bytes;
+    }
+};
+
+#endif // !BitmapIndex_h
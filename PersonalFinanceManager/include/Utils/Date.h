@@ -29,7 +29,6 @@ public:
     // ==========================================
     Date();
     Date(int d, int m, int y);
-    ~Date();
     
     // ==========================================
     // 2. GETTERS
@@ -80,6 +79,9 @@ public:
     static bool IsLeapYear(int y);
     static int DaysInMonth(int m, int y);
     static Date GetEndOfMonth(int m, int y);
+
+    /// @brief Days since 1970-01-01 (negative before it); consecutive dates differ by 1.
+    long long DayNumber() const;
     
     /**
      * @brief Returns current system date.
@@ -0,0 +1,93 @@
+//
+//  EntityId.h
+//  PersonalFinanceManager
+//
+
+#ifndef EntityId_h
+#define EntityId_h
+
+#include "Enums.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+/**
+ * @struct EntityId
+ * @brief Fixed-capacity inline identifier for the "PREFIX-XXXX-XXXX-XXXX" IDs.
+ *
+ * Generated IDs are 18 characters long, just past the small-string buffer of
+ * std::string, so storing them as strings costs one heap allocation each.
+ * EntityId keeps the characters inline in a 24-byte POD:
+ *
+ *   [ text (18) | length (1) | prefix tag (1) | hash (4) ]
+ *
+ * The hash is computed once on construction and is what HashMap uses through
+ * the default Hasher<T> strategy (key.hash()). A zero-initialised EntityId is
+ * the empty ID.
+ */
+struct EntityId {
+    static const size_t CAPACITY = 18;
+
+    char text[CAPACITY];    // Zero-padded, not null-terminated when full
+    uint8_t length;
+    uint8_t prefix;         // 0 = none, otherwise IdPrefix + 1
+    uint32_t hashCode;
+
+    // ==========================================
+    // 1. FACTORIES
+    // ==========================================
+
+    /**
+     * @brief Builds an ID from its string form.
+     * Strings longer than CAPACITY cannot be valid IDs and yield the empty ID,
+     * which no stored record carries, so lookups with arbitrary user input
+     * simply miss. Callers that treat "empty" as "unset" must track that
+     * separately (see TransactionQuery::HasWallet).
+     */
+    static EntityId FromString(const std::string& str) { return FromChars(str.data(), str.size()); }
+    static EntityId FromChars(const char* str, size_t length);
+
+    static EntityId Empty() { return EntityId{}; }
+
+    // ==========================================
+    // 2. ACCESSORS
+    // ==========================================
+
+    std::string ToString() const { return std::string(text, length); }
+
+    bool IsEmpty() const { return length == 0; }
+
+    /// @brief True if the prefix tag was recognised (TRX, WAL, CAT, SRC, REC).
+    bool HasPrefix() const { return prefix != 0; }
+
+    IdPrefix GetPrefix() const { return static_cast<IdPrefix>(prefix - 1); }
+
+    /// @brief Precomputed hash, picked up by Hasher<EntityId>.
+    unsigned long hash() const { return hashCode; }
+
+    // ==========================================
+    // 3. OPERATORS
+    // ==========================================
+
+    /**
+     * @brief Word-wise equality.
+     * The tail word holds the last two characters, length, tag and hash, so
+     * it rejects almost every mismatch; two 64-bit compares cover the rest.
+     */
+    bool operator==(const EntityId& other) const {
+        uint64_t a[3], b[3];
+        std::memcpy(a, this, sizeof(a));
+        std::memcpy(b, &other, sizeof(b));
+        return a[2] == b[2] && a[0] == b[0] && a[1] == b[1];
+    }
+
+    bool operator!=(const EntityId& other) const { return !(*this == other); }
+};
+
+static_assert(sizeof(EntityId) == 24, "EntityId must stay a 24-byte inline value");
+static_assert(std::is_trivially_copyable<EntityId>::value, "EntityId must be trivially copyable");
+static_assert(std::is_standard_layout<EntityId>::value, "EntityId must have a standard layout");
+
+#endif // !EntityId_h
@@ -0,0 +1,169 @@
+//
+//  FenwickTree.h
+//  PersonalFinanceManager
+//
+
+#ifndef FenwickTree_h
+#define FenwickTree_h
+
+#include "ArrayList.h"
+
+#include <climits>
+#include <cstddef>
+
+/**
+ * @class FenwickTree
+ * @brief Prefix sums over integer keys with O(log n) point updates and range sums.
+ *
+ * Keys are grouped into fixed blocks of BLOCK_KEYS consecutive keys, and
+ * only blocks holding a key are allocated, so a stray far-off key (a
+ * mistyped year) costs one block rather than every key in between. Each
+ * block is a Fenwick tree over its keys: node i holds the sum of the
+ * (i & -i) keys ending at i, so a prefix sum adds one node per set bit of
+ * its length and an update touches one node per level. A second Fenwick
+ * tree over the block totals, in key order, gives the sum of every block
+ * before a key. A new block is spliced in and that tree rebuilt in
+ * O(blocks).
+ *
+ * @tparam T Summable value: default-constructs to zero and supports +=, -= and -.
+ */
+template <typename T>
+class FenwickTree {
+public:
+    /// Keys per block (with day numbers: about 2.8 years).
+    static const size_t BLOCK_KEYS = 1024;
+
+private:
+    struct Block {
+        long long first; // First key, a multiple of BLOCK_KEYS
+        T* tree;         // 1-based nodes over the block's keys (tree[0] unused)
+    };
+
+    ArrayList<Block> blocks; // In key order
+    T* totals;               // 1-based nodes over the block totals, in block order
+
+    static long long BlockStart(long long key) {
+        long long quotient = key / static_cast<long long>(BLOCK_KEYS);
+        if (key % static_cast<long long>(BLOCK_KEYS) < 0) --quotient; // Round down for negative keys
+        return quotient * static_cast<long long>(BLOCK_KEYS);
+    }
+
+    /// @brief Index of the first block starting at or after 'first'.
+    size_t LowerBound(long long first) const {
+        size_t low = 0, high = blocks.Count();
+        while (low < high) {
+            size_t mid = low + (high - low) / 2;
+            if (blocks[mid].first < first) low = mid + 1;
+            else high = mid;
+        }
+        return low;
+    }
+
+    /// @brief Sum of the first 'count' entries of a 1-based node array.
+    static T Prefix(const T* nodes, size_t count) {
+        T sum = T();
+        for (size_t i = count; i > 0; i -= i & (~i + 1)) sum += nodes[i];
+        return sum;
+    }
+
+    static void Update(T* nodes, size_t size, size_t index, const T& delta, bool add) {
+        for (size_t i = index + 1; i <= size; i += i & (~i + 1)) {
+            if (add) nodes[i] += delta;
+            else nodes[i] -= delta;
+        }
+    }
+
+    /// @brief Adds an empty block at 'index' and rebuilds the totals tree in O(blocks).
+    void InsertBlock(size_t index, long long first) {
+        Block block;
+        block.first = first;
+        block.tree = new T[BLOCK_KEYS + 1]();
+        blocks.Insert(index, block);
+
+        size_t count = blocks.Count();
+        delete[] totals;
+        totals = new T[count + 1]();
+        for (size_t i = 1; i <= count; ++i) totals[i] = Prefix(blocks[i - 1].tree, BLOCK_KEYS);
+        for (size_t i = 1; i <= count; ++i) {
+            size_t parent = i + (i & (~i + 1));
+            if (parent <= count) totals[parent] += totals[i];
+        }
+    }
+
+    /// @brief Sum over every key below 'key'.
+    T Before(long long key) const {
+        long long first = BlockStart(key);
+        size_t index = LowerBound(first);
+
+        T sum = Prefix(totals, index);
+        if (index < blocks.Count() && blocks[index].first == first) {
+            sum += Prefix(blocks[index].tree, static_cast<size_t>(key - first));
+        }
+        return sum;
+    }
+
+public:
+    // ==========================================
+    // 1. CONSTRUCTOR & DESTRUCTOR
+    // ==========================================
+    FenwickTree() : totals(nullptr) { }
+
+    ~FenwickTree() { Clear(); }
+
+    FenwickTree(const FenwickTree&) = delete;
+    FenwickTree& operator=(const FenwickTree&) = delete;
+
+    // ==========================================
+    // 2. UPDATES
+    // ==========================================
+    void Add(long long key, const T& delta) {
+        long long first = BlockStart(key);
+        size_t index = LowerBound(first);
+        if (index == blocks.Count() || blocks[index].first != first) InsertBlock(index, first);
+
+        Update(blocks[index].tree, BLOCK_KEYS, static_cast<size_t>(key - first), delta, true);
+        Update(totals, blocks.Count(), index, delta, true);
+    }
+
+    void Subtract(long long key, const T& delta) {
+        long long first = BlockStart(key);
+        size_t index = LowerBound(first);
+        if (index == blocks.Count() || blocks[index].first != first) return;
+
+        Update(blocks[index].tree, BLOCK_KEYS, static_cast<size_t>(key - first), delta, false);
+        Update(totals, blocks.Count(), index, delta, false);
+    }
+
+    void Clear() {
+        for (size_t i = 0; i < blocks.Count(); ++i) delete[] blocks[i].tree;
+        blocks.Clear();
+        delete[] totals;
+        totals = nullptr;
+    }
+
+    // ==========================================
+    // 3. QUERIES
+    // ==========================================
+
+    /// @brief Sum over keys [first, last].
+    T Sum(long long first, long long last) const {
+        if (blocks.IsEmpty() || first > last) return T();
+
+        T upTo = (last == LLONG_MAX) ? Prefix(totals, blocks.Count()) : Before(last + 1);
+        return upTo - Before(first);
+    }
+
+    // ==========================================
+    // 4. DIAGNOSTICS
+    // ==========================================
+
+    /// @brief Keys covered by allocated blocks.
+    size_t Capacity() const { return blocks.Count() * BLOCK_KEYS; }
+
+    size_t BytesReserved() const {
+        if (blocks.IsEmpty()) return blocks.BytesReserved();
+        return blocks.BytesReserved() + blocks.Count() * (BLOCK_KEYS + 1) * sizeof(T) + (blocks.Count() + 1) * sizeof(T);
+    }
+};
+
+#endif // !FenwickTree_h
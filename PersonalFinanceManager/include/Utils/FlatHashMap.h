@@ -0,0 +1,147 @@
+//
+//  FlatHashMap.h
+//  PersonalFinanceManager
+//
+
+#ifndef FlatHashMap_h
+#define FlatHashMap_h
+
+#include "HashStrategies.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class FlatHashMap
+ * @brief Open-addressing hash table for small accumulator tables.
+ *
+ * Entries sit inline in one power-of-two array and collisions probe the
+ * next slot (linear probing), so a lookup touches one or two adjacent
+ * cache lines and never chases a chain pointer. There is no Remove:
+ * entries are only added, as by a group-by pass that looks up its group
+ * once per row, or a rollup whose emptied cells keep their entry.
+ *
+ * @tparam K Key (needs a Hasher and KeyComparer, like HashMap).
+ * @tparam V Value; default-constructed on first access through operator[].
+ */
+template <typename K, typename V>
+class FlatHashMap {
+private:
+    struct Entry {
+        K key;
+        V value;
+    };
+
+    Entry* entries;
+    bool* used;
+    size_t capacity; // Power of two
+    size_t size;
+
+    static const size_t DEFAULT_CAPACITY = 16;
+
+    /// @brief Home slot; Fibonacci hashing spreads sequential integer keys (months, types).
+    size_t Home(const K& key) const {
+        uint64_t hash = static_cast<uint64_t>(Hasher<K>::GetHash(key)) * 0x9E3779B97F4A7C15ull;
+        return static_cast<size_t>(hash >> 32) & (capacity - 1);
+    }
+
+    /// @brief Slot holding 'key', or the empty slot where it would go.
+    size_t Probe(const K& key) const {
+        size_t slot = Home(key);
+        while (used[slot] && !KeyComparer<K>::AreEqual(entries[slot].key, key)) {
+            slot = (slot + 1) & (capacity - 1);
+        }
+        return slot;
+    }
+
+    void Grow() {
+        Entry* oldEntries = entries;
+        bool* oldUsed = used;
+        size_t oldCapacity = capacity;
+
+        capacity *= 2;
+        entries = new Entry[capacity];
+        used = new bool[capacity]();
+        for (size_t i = 0; i < oldCapacity; ++i) {
+            if (!oldUsed[i]) continue;
+            size_t slot = Probe(oldEntries[i].key);
+            used[slot] = true;
+            entries[slot] = oldEntries[i];
+        }
+        delete[] oldEntries;
+        delete[] oldUsed;
+    }
+
+public:
+    // ==========================================
+    // 1. CONSTRUCTOR & DESTRUCTOR
+    // ==========================================
+    explicit FlatHashMap(size_t expected = DEFAULT_CAPACITY / 2) : capacity(DEFAULT_CAPACITY), size(0) {
+        while (capacity < expected * 2) capacity *= 2; // Load factor stays <= 1/2
+        entries = new Entry[capacity];
+        used = new bool[capacity]();
+    }
+
+    ~FlatHashMap() {
+        delete[] entries;
+        delete[] used;
+    }
+
+    FlatHashMap(const FlatHashMap&) = delete;
+    FlatHashMap& operator=(const FlatHashMap&) = delete;
+
+    // ==========================================
+    // 2. ACCESS
+    // ==========================================
+
+    /// @brief Value for 'key', inserted default-constructed if absent.
+    V& operator[](const K& key) {
+        size_t slot = Probe(key);
+        if (used[slot]) return entries[slot].value;
+
+        if ((size + 1) * 2 > capacity) {
+            Grow();
+            slot = Probe(key);
+        }
+        used[slot] = true;
+        entries[slot].key = key;
+        entries[slot].value = V();
+        ++size;
+        return entries[slot].value;
+    }
+
+    /// @brief Value for 'key', or nullptr if absent.
+    V* Get(const K& key) {
+        size_t slot = Probe(key);
+        return used[slot] ? &entries[slot].value : nullptr;
+    }
+
+    const V* Get(const K& key) const {
+        size_t slot = Probe(key);
+        return used[slot] ? &entries[slot].value : nullptr;
+    }
+
+    /// @brief Calls visit(key, value) for every entry, in slot order.
+    template <typename Visit>
+    void ForEach(Visit visit) const {
+        for (size_t i = 0; i < capacity; ++i) {
+            if (used[i]) visit(entries[i].key, entries[i].value);
+        }
+    }
+
+    void Clear() {
+        for (size_t i = 0; i < capacity; ++i) used[i] = false;
+        size = 0;
+    }
+
+    size_t Count() const { return size; }
+    bool IsEmpty() const { return size == 0; }
+
+    // ==========================================
+    // 3. DIAGNOSTICS
+    // ==========================================
+    size_t Capacity() const { return capacity; }
+    size_t BytesReserved() const { return capacity * (sizeof(Entry) + sizeof(bool)); }
+};
+
+#endif // !FlatHashMap_h
@@ -10,8 +10,10 @@
 
 #include "HashStrategies.h"
 #include "ArrayList.h"
+#include "Region.h"
 
 #include <algorithm>
+#include <type_traits>
 
 /**
  * @struct HashNode
@@ -30,11 +32,14 @@ struct HashNode {
  * @class HashMap
  * @brief Key-Value store implementing a Hash Table with Chaining.
  * * Uses 'HashStrategies.h' to handle hashing of different types (int, string, char*).
+ * * Nodes live in a Region, so clearing a map of trivially destructible
+ *   keys/values drops whole blocks instead of walking every chain.
  */
 template <typename K, typename V>
 class HashMap {
 private:
     HashNode<K, V>** buckets; // Array of pointers to nodes
+    Region<HashNode<K, V>> nodes;
     size_t size;
     size_t capacity;
     double maxLoadFactor;
@@ -43,6 +48,28 @@ private:
     static const size_t DEFAULT_CAPACITY = 16;
     static constexpr double DEFAULT_LOAD_FACTOR = 0.75;
     
+    static constexpr bool TRIVIAL_NODES =
+        std::is_trivially_destructible<K>::value && std::is_trivially_destructible<V>::value;
+    
+    /**
+     * @brief Frees every node. Trivial nodes are dropped with the region's
+     * blocks; otherwise each chain is walked so destructors run.
+     */
+    void ReleaseNodes() {
+        if (!TRIVIAL_NODES) {
+            for (size_t i = 0; i < capacity; ++i) {
+                HashNode<K, V>* entry = buckets[i];
+                while (entry != nullptr) {
+                    HashNode<K, V>* prev = entry;
+                    entry = entry->next;
+                    nodes.Free(prev);
+                }
+            }
+        }
+        nodes.Release();
+        size = 0;
+    }
+    
     /**
      * @brief Calculates the bucket index for a specific key.
      */
@@ -97,7 +124,7 @@ public:
     }
 
     ~HashMap() {
-        Clear();
+        ReleaseNodes();
         delete[] buckets;
     }
 
@@ -119,7 +146,7 @@ public:
             entry = entry->next;
         }
         
-        HashNode<K, V>* newNode = new HashNode<K, V>(key, value);
+        HashNode<K, V>* newNode = nodes.Allocate(key, value);
         newNode->next = buckets[bucketIndex];
         buckets[bucketIndex] = newNode;
         
@@ -136,7 +163,7 @@ public:
                 if (prev == nullptr) buckets[bucketIndex] = entry->next;
                 else prev->next = entry->next;
                 
-                delete entry;
+                nodes.Free(entry);
                 size--;
                 return;
             }
@@ -146,16 +173,9 @@ public:
     }
 
     void Clear() {
-        for (size_t i = 0; i < capacity; ++i) {
-            HashNode<K, V>* entry = buckets[i];
-            while (entry != nullptr) {
-                HashNode<K, V>* prev = entry;
-                entry = entry->next;
-                delete prev;
-            }
+        ReleaseNodes();
+        for (size_t i = 0; i < capacity; ++i)
             buckets[i] = nullptr;
-        }
-        size = 0;
     }
 
     // ==========================================
@@ -192,7 +212,7 @@ public:
         }
 
         V defaultValue = V();
-        HashNode<K, V>* newNode = new HashNode<K, V>(key, defaultValue);
+        HashNode<K, V>* newNode = nodes.Allocate(key, defaultValue);
         newNode->next = buckets[bucketIndex];
         buckets[bucketIndex] = newNode;
         size++;
@@ -210,6 +230,36 @@ public:
 
     bool IsEmpty() const { return size == 0; }
     
+    size_t BucketCount() const { return capacity; }
+    
+    double LoadFactor() const { return static_cast<double>(size) / capacity; }
+    
+    /// @brief Heap bytes held by the bucket array and the node region.
+    size_t BytesReserved() const {
+        return capacity * sizeof(HashNode<K, V>*) + nodes.BytesReserved();
+    }
+    
+    /**
+     * @brief Counts buckets by chain length.
+     * histogram[i] receives the number of buckets holding i nodes; the last
+     * bin collects every longer chain.
+     * @return The longest chain.
+     */
+    size_t ChainHistogram(size_t histogram[], size_t bins) const {
+        for (size_t i = 0; i < bins; ++i) histogram[i] = 0;
+        
+        size_t longest = 0;
+        for (size_t i = 0; i < capacity; ++i) {
+            size_t length = 0;
+            for (HashNode<K, V>* entry = buckets[i]; entry != nullptr; entry = entry->next)
+                ++length;
+            
+            histogram[std::min(length, bins - 1)]++;
+            longest = std::max(longest, length);
+        }
+        return longest;
+    }
+    
     ArrayList<K> Keys() {
         ArrayList<K> keys;
         for (size_t i = 0; i < capacity; ++i) {
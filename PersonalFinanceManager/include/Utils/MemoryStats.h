@@ -0,0 +1,208 @@
+//
+//  MemoryStats.h
+//  PersonalFinanceManager
+//
+
+#ifndef MemoryStats_h
+#define MemoryStats_h
+
+#include "ArrayList.h"
+#include "HashMap.h"
+#include "Region.h"
+#include "SortedChunkList.h"
+#include "StringArena.h"
+#include "TrigramIndex.h"
+#include "BitmapIndex.h"
+#include "MonthlyRollup.h"
+#include "FenwickTree.h"
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+
+/**
+ * @struct MemoryStats
+ * @brief Footprint of one in-memory table, index or buffer.
+ *
+ * Byte counts are shallow: they cover the container's own heap blocks
+ * (arrays, buckets, node regions, arena) plus fixed-size records it owns,
+ * not heap buffers hidden inside std::string members.
+ */
+struct MemoryStats {
+    static const size_t CHAIN_BINS = 5; // Chain lengths 0, 1, 2, 3, 4+
+
+    std::string name;
+    size_t count;           // Live elements / entries
+    size_t capacity;        // Slots, buckets or bytes reserved
+    size_t bytes;           // Heap bytes reserved
+    size_t wastedBytes;     // Reserved but not holding live data
+
+    // Hash tables only
+    bool isHashTable;
+    double loadFactor;
+    size_t longestChain;
+    size_t chainHistogram[CHAIN_BINS];
+
+    MemoryStats() : count(0), capacity(0), bytes(0), wastedBytes(0),
+                    isHashTable(false), loadFactor(0), longestChain(0), chainHistogram{} { }
+
+    // ==========================================
+    // 1. COLLECTORS
+    // ==========================================
+
+    template <typename T>
+    static MemoryStats OfList(const std::string& name, const ArrayList<T>& list) {
+        MemoryStats s;
+        s.name = name;
+        s.count = list.Count();
+        s.capacity = list.Capacity();
+        s.bytes = list.BytesReserved();
+        s.wastedBytes = (list.Capacity() - list.Count()) * sizeof(T);
+        return s;
+    }
+
+    template <typename T, typename Less>
+    static MemoryStats OfList(const std::string& name, const SortedChunkList<T, Less>& list) {
+        MemoryStats s;
+        s.name = name;
+        s.count = list.Count();
+        s.capacity = list.Capacity();
+        s.bytes = list.BytesReserved();
+        s.wastedBytes = (list.Capacity() - list.Count()) * sizeof(T);
+        return s;
+    }
+
+    /// @brief A list of owned pointers: the array plus one record per element.
+    template <typename T>
+    static MemoryStats OfOwningList(const std::string& name, const ArrayList<T*>& list) {
+        MemoryStats s = OfList(name, list);
+        s.bytes += list.Count() * sizeof(T);
+        return s;
+    }
+
+    template <typename T>
+    static MemoryStats OfRegion(const std::string& name, const Region<T>& region) {
+        MemoryStats s;
+        s.name = name;
+        s.count = region.Count();
+        s.capacity = region.SlotCount();
+        s.bytes = region.BytesReserved();
+        s.wastedBytes = region.BytesReserved() - region.BytesInUse();
+        return s;
+    }
+
+    static MemoryStats OfArena(const std::string& name, const StringArena& arena, size_t strings) {
+        MemoryStats s;
+        s.name = name;
+        s.count = strings;
+        s.capacity = arena.Capacity();
+        s.bytes = arena.Capacity();
+        s.wastedBytes = arena.Capacity() - arena.LiveBytes();
+        return s;
+    }
+
+    template <typename K, typename V>
+    static MemoryStats OfMap(const std::string& name, const HashMap<K, V>& map) {
+        MemoryStats s;
+        s.name = name;
+        s.isHashTable = true;
+        s.count = map.Count();
+        s.capacity = map.BucketCount();
+        s.bytes = map.BytesReserved();
+        s.loadFactor = map.LoadFactor();
+        s.longestChain = map.ChainHistogram(s.chainHistogram, CHAIN_BINS);
+
+        // Empty buckets and unused node slots
+        size_t nodeBytes = map.Count() * sizeof(HashNode<K, V>);
+        size_t usedBucketBytes = (map.BucketCount() - s.chainHistogram[0]) * sizeof(HashNode<K, V>*);
+        s.wastedBytes = s.bytes - nodeBytes - usedBucketBytes;
+        return s;
+    }
+
+    /// @brief A map of owned posting lists (the secondary indexes).
+    template <typename K, typename T, typename Less>
+    static MemoryStats OfIndex(const std::string& name, HashMap<K, SortedChunkList<T, Less>*>& index) {
+        MemoryStats s = OfMap(name, index);
+
+        ArrayList<SortedChunkList<T, Less>*> lists = index.Values();
+        for (size_t i = 0; i < lists.Count(); ++i) {
+            const SortedChunkList<T, Less>* list = lists[i];
+            s.bytes += sizeof(SortedChunkList<T, Less>) + list->BytesReserved();
+            s.wastedBytes += (list->Capacity() - list->Count()) * sizeof(T);
+        }
+        return s;
+    }
+
+    /// @brief A trigram index (count = postings, capacity = distinct trigrams).
+    static MemoryStats OfTrigramIndex(const std::string& name, const TrigramIndex& index) {
+        MemoryStats s;
+        s.name = name;
+        s.count = index.PostingCount();
+        s.capacity = index.TrigramCount();
+        s.bytes = index.BytesReserved();
+        s.wastedBytes = index.BytesUnused();
+        return s;
+    }
+
+    /// @brief Column bitmaps (count = rows set across all values, capacity = values).
+    template <typename K>
+    static MemoryStats OfBitmapIndex(const std::string& name, const BitmapIndex<K>& index) {
+        MemoryStats s;
+        s.name = name;
+        s.count = index.RowCount();
+        s.capacity = index.ValueCount();
+        s.bytes = index.BytesReserved();
+        return s;
+    }
+
+    /// @brief A monthly rollup (count = cells, capacity = months).
+    static MemoryStats OfRollup(const std::string& name, const MonthlyRollup& rollup) {
+        MemoryStats s;
+        s.name = name;
+        s.count = rollup.CellCount();
+        s.capacity = rollup.MonthCount();
+        s.bytes = rollup.BytesReserved();
+        return s;
+    }
+
+    /// @brief A Fenwick tree (capacity = keys covered).
+    template <typename T>
+    static MemoryStats OfFenwickTree(const std::string& name, const FenwickTree<T>& tree) {
+        MemoryStats s;
+        s.name = name;
+        s.capacity = tree.Capacity();
+        s.bytes = tree.BytesReserved();
+        return s;
+    }
+
+    /// @brief One Fenwick tree per key (count = trees, capacity = keys covered across them).
+    template <typename K, typename T>
+    static MemoryStats OfFenwickMap(const std::string& name, HashMap<K, FenwickTree<T>*>& map) {
+        MemoryStats s = OfMap(name, map);
+        ArrayList<FenwickTree<T>*> trees = map.Values();
+        s.capacity = 0;
+        for (size_t i = 0; i < trees.Count(); ++i) {
+            s.capacity += trees[i]->Capacity();
+            s.bytes += sizeof(FenwickTree<T>) + trees[i]->BytesReserved();
+        }
+        return s;
+    }
+};
+
+/**
+ * @struct MemoryReport
+ * @brief Snapshot of every structure the ledger keeps in RAM.
+ */
+struct MemoryReport {
+    ArrayList<MemoryStats> entries;
+
+    void Add(const MemoryStats& stats) { entries.Add(stats); }
+
+    size_t TotalBytes() const;
+    size_t TotalWastedBytes() const;
+
+    /// @brief Plain-text dump (one line per structure, then the hash chain histograms).
+    void Print(std::ostream& out) const;
+};
+
+#endif // !MemoryStats_h
@@ -0,0 +1,156 @@
+//
+//  MonthlyRollup.h
+//  PersonalFinanceManager
+//
+
+#ifndef MonthlyRollup_h
+#define MonthlyRollup_h
+
+#include "ArrayList.h"
+#include "HashMap.h"
+#include "FlatHashMap.h"
+#include "EntityId.h"
+
+#include <cstddef>
+
+/**
+ * @struct RollupKey
+ * @brief One cell of a month: type x wallet x category (or source).
+ */
+struct RollupKey {
+    EntityId wallet;
+    EntityId category;
+    int type;
+
+    RollupKey() : wallet(), category(), type(0) { }
+    RollupKey(int t, const EntityId& w, const EntityId& c) : wallet(w), category(c), type(t) { }
+
+    unsigned long hash() const { return (wallet.hash() * 31) ^ category.hash() ^ static_cast<unsigned long>(type); }
+    bool operator==(const RollupKey& other) const { return type == other.type && wallet == other.wallet && category == other.category; }
+};
+
+/**
+ * @struct RollupTotals
+ * @brief Rows and amount total of one cell.
+ */
+struct RollupTotals {
+    size_t count;
+    double sum;
+
+    RollupTotals() : count(0), sum(0) { }
+};
+
+/**
+ * @class MonthlyRollup
+ * @brief Count and amount total per (month, type, wallet, category), kept up to date row by row.
+ *
+ * A month holds one cell per type / wallet / category combination that
+ * ever occurred in it, so a total over whole months costs
+ * O(months x cells) however many transactions they contain. Removing a
+ * row subtracts it again; a cell that drops to zero rows stays (empty)
+ * and is reset to an exact zero sum, so rounding cannot accumulate.
+ *
+ * Months are numbered year * 12 + month - 1.
+ */
+class MonthlyRollup {
+private:
+    typedef FlatHashMap<RollupKey, RollupTotals> Cells;
+
+    HashMap<int, Cells*>* months;
+    size_t rows;
+
+public:
+    // ==========================================
+    // 1. CONSTRUCTOR & DESTRUCTOR
+    // ==========================================
+    MonthlyRollup() : months(new HashMap<int, Cells*>()), rows(0) { }
+
+    ~MonthlyRollup() {
+        Clear();
+        delete months;
+    }
+
+    MonthlyRollup(const MonthlyRollup&) = delete;
+    MonthlyRollup& operator=(const MonthlyRollup&) = delete;
+
+    // ==========================================
+    // 2. UPDATES
+    // ==========================================
+    void Add(int month, const RollupKey& key, double amount) {
+        Cells*& cells = (*months)[month];
+        if (cells == nullptr) cells = new Cells();
+
+        RollupTotals& totals = (*cells)[key];
+        ++totals.count;
+        totals.sum += amount;
+        ++rows;
+    }
+
+    /// @brief Undoes an Add with the same month, key and amount.
+    void Remove(int month, const RollupKey& key, double amount) {
+        Cells** cells = months->Get(month);
+        RollupTotals* totals = (cells != nullptr) ? (*cells)->Get(key) : nullptr;
+        if (totals == nullptr || totals->count == 0) return;
+
+        if (--totals->count == 0) totals->sum = 0;
+        else totals->sum -= amount;
+        --rows;
+    }
+
+    void Clear() {
+        ArrayList<Cells*> owned = months->Values();
+        for (size_t i = 0; i < owned.Count(); ++i) delete owned[i];
+        months->Clear();
+        rows = 0;
+    }
+
+    // ==========================================
+    // 3. ACCESS
+    // ==========================================
+
+    /// @brief Calls visit(month, key, totals) for every non-empty cell of months [first, last].
+    template <typename Visit>
+    void ForEachCell(int first, int last, Visit visit) const {
+        if (first > last) return;
+
+        // A short range probes its months; a long one (e.g. all time) filters the months present
+        ArrayList<int> present;
+        long long span = static_cast<long long>(last) - first;
+        bool probe = span < static_cast<long long>(months->Count());
+        if (!probe) present = months->Keys();
+
+        size_t total = probe ? static_cast<size_t>(span) + 1 : present.Count();
+        for (size_t i = 0; i < total; ++i) {
+            int month = probe ? first + static_cast<int>(i) : present[i];
+            if (month < first || month > last) continue;
+
+            Cells** cells = months->Get(month);
+            if (cells == nullptr) continue;
+            (*cells)->ForEach([&](const RollupKey& key, const RollupTotals& totals) {
+                if (totals.count > 0) visit(month, key, totals);
+            });
+        }
+    }
+
+    // ==========================================
+    // 4. DIAGNOSTICS
+    // ==========================================
+    size_t RowCount() const { return rows; }
+    size_t MonthCount() const { return months->Count(); }
+
+    size_t CellCount() const {
+        size_t cells = 0;
+        ArrayList<Cells*> owned = months->Values();
+        for (size_t i = 0; i < owned.Count(); ++i) cells += owned[i]->Count();
+        return cells;
+    }
+
+    size_t BytesReserved() const {
+        size_t bytes = months->BytesReserved();
+        ArrayList<Cells*> owned = months->Values();
+        for (size_t i = 0; i < owned.Count(); ++i) bytes += sizeof(Cells) + owned[i]->BytesReserved();
+        return bytes;
+    }
+};
+
+#endif // !MonthlyRollup_h
@@ -0,0 +1,120 @@
+//
+//  Region.h
+//  PersonalFinanceManager
+//
+
+#ifndef Region_h
+#define Region_h
+
+#include "ArrayList.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+/**
+ * @class Region
+ * @brief Block allocator that owns many objects of one type.
+ *
+ * Objects are carved out of large blocks (sizes double up to MAX_BLOCK_SIZE)
+ * and freed slots are recycled through an intrusive free list. Release()
+ * drops every block at once without visiting individual objects, so wiping a
+ * table of millions of records costs a few delete[] calls.
+ *
+ * @warning Release() does not run destructors. Owners of non-trivially
+ * destructible types must Free() live objects first.
+ *
+ * @tparam T The type of objects stored in the region.
+ */
+template <typename T>
+class Region {
+private:
+    union Slot {
+        alignas(T) unsigned char storage[sizeof(T)];
+        Slot* next;
+    };
+
+    ArrayList<Slot*> blocks;
+    size_t blockSize;       // Size of the last block
+    size_t usedInBlock;     // Slots handed out from the last block
+    Slot* freeList;
+    size_t liveCount;
+    size_t slotCount;       // Total slots across all blocks
+
+    static constexpr size_t MIN_BLOCK_SIZE = 16;
+    static constexpr size_t MAX_BLOCK_SIZE = 4096;
+
+    Slot* NextSlot() {
+        if (freeList != nullptr) {
+            Slot* slot = freeList;
+            freeList = slot->next;
+            return slot;
+        }
+
+        if (blocks.IsEmpty() || usedInBlock == blockSize) {
+            blockSize = blocks.IsEmpty() ? MIN_BLOCK_SIZE : std::min(blockSize * 2, MAX_BLOCK_SIZE);
+            blocks.Add(new Slot[blockSize]);
+            slotCount += blockSize;
+            usedInBlock = 0;
+        }
+        return &blocks[blocks.Count() - 1][usedInBlock++];
+    }
+
+public:
+    // ==========================================
+    // 1. CONSTRUCTORS & DESTRUCTOR
+    // ==========================================
+
+    Region() : blocks(4), blockSize(0), usedInBlock(0), freeList(nullptr), liveCount(0), slotCount(0) { }
+
+    ~Region() { Release(); }
+
+    Region(const Region&) = delete;
+    Region& operator=(const Region&) = delete;
+
+    // ==========================================
+    // 2. ALLOCATION
+    // ==========================================
+
+    template <typename... Args>
+    T* Allocate(Args&&... args) {
+        Slot* slot = NextSlot();
+        T* obj = new (slot->storage) T(std::forward<Args>(args)...);
+        ++liveCount;
+        return obj;
+    }
+
+    /// @brief Destroys one object and recycles its slot.
+    void Free(T* obj) {
+        if (obj == nullptr) return;
+        obj->~T();
+
+        Slot* slot = reinterpret_cast<Slot*>(obj);
+        slot->next = freeList;
+        freeList = slot;
+        --liveCount;
+    }
+
+    /// @brief Drops every block in O(blocks). Destructors are NOT run.
+    void Release() {
+        for (size_t i = 0; i < blocks.Count(); ++i) {
+            delete[] blocks[i];
+        }
+        blocks.Clear();
+        blockSize = usedInBlock = liveCount = slotCount = 0;
+        freeList = nullptr;
+    }
+
+    // ==========================================
+    // 3. STATE
+    // ==========================================
+
+    size_t Count() const { return liveCount; }
+    size_t SlotCount() const { return slotCount; }
+    size_t BlockCount() const { return blocks.Count(); }
+    size_t BytesReserved() const { return slotCount * sizeof(Slot); }
+    size_t BytesInUse() const { return liveCount * sizeof(Slot); }
+};
+
+#endif // !Region_h
@@ -0,0 +1,163 @@
+//
+//  RoaringBitmap.h
+//  PersonalFinanceManager
+//
+
+#ifndef RoaringBitmap_h
+#define RoaringBitmap_h
+
+#include "ArrayList.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * @class RoaringBitmap
+ * @brief Compressed set of 32-bit row ids with fast AND / OR / AND NOT.
+ *
+ * Ids are split by their high 16 bits into containers of up to 65,536 ids.
+ * A container holds either a sorted array of the low 16 bits (up to
+ * ARRAY_LIMIT ids, 2 bytes each) or a 65,536-bit bitset (8 KB), whichever
+ * is smaller, and switches form as it grows or shrinks. Set operations
+ * only pair containers with equal keys, and bitset pairs run 64 ids per
+ * word operation.
+ *
+ * Ids are usually added in increasing order, which appends without any
+ * search or shift.
+ */
+class RoaringBitmap {
+public:
+    /// Largest array container; one more id turns it into a bitset.
+    static constexpr uint32_t ARRAY_LIMIT = 4096;
+
+    /// 64-bit words in a bitset container.
+    static constexpr uint32_t BITSET_WORDS = 1024;
+
+private:
+    /**
+     * @struct Container
+     * @brief Ids sharing one high half: a sorted array or a bitset (never both).
+     */
+    struct Container {
+        uint16_t key;      // High 16 bits
+        uint32_t count;    // Ids held
+        uint32_t capacity; // Array slots (0 for a bitset)
+        uint16_t* values;  // Array form: sorted low halves
+        uint64_t* words;   // Bitset form: BITSET_WORDS words
+
+        explicit Container(uint16_t k) : key(k), count(0), capacity(0), values(nullptr), words(nullptr) { }
+        ~Container() { delete[] values; delete[] words; }
+
+        Container(const Container&) = delete;
+        Container& operator=(const Container&) = delete;
+
+        bool IsBitset() const { return words != nullptr; }
+        bool Contains(uint16_t low) const;
+
+        /// @return false if 'low' was already present.
+        bool Add(uint16_t low);
+
+        /// @return false if 'low' was absent.
+        bool Remove(uint16_t low);
+
+        void Reserve(uint32_t needed);
+        void ToBitset();
+        void ToArray();   // Requires count <= ARRAY_LIMIT
+        void Normalize(); // Picks the smaller form for the current count
+        Container* Clone() const;
+
+        void And(const Container& other);
+        void Or(const Container& other);
+        void AndNot(const Container& other);
+    };
+
+    ArrayList<Container*> containers; // Ascending key
+    size_t size;
+
+    /// @brief Position of the container for 'key', or where it would be inserted.
+    size_t Find(uint16_t key) const;
+    void Release();
+
+public:
+    // ==========================================
+    // 1. CONSTRUCTOR & DESTRUCTOR
+    // ==========================================
+    RoaringBitmap() : containers(4), size(0) { }
+    ~RoaringBitmap() { Release(); }
+
+    RoaringBitmap(const RoaringBitmap&) = delete;
+    RoaringBitmap& operator=(const RoaringBitmap&) = delete;
+
+    /// @brief Replaces the contents with a copy of 'other'.
+    void Assign(const RoaringBitmap& other);
+
+    // ==========================================
+    // 2. UPDATES
+    // ==========================================
+    void Add(uint32_t id);
+    void Remove(uint32_t id);
+    void Clear() { Release(); }
+
+    // ==========================================
+    // 3. SET OPERATIONS (in place)
+    // ==========================================
+    void And(const RoaringBitmap& other);
+    void Or(const RoaringBitmap& other);
+    void AndNot(const RoaringBitmap& other); // NOT relative to a universe: universe.AndNot(set)
+
+    // ==========================================
+    // 4. ACCESS
+    // ==========================================
+    bool Contains(uint32_t id) const;
+    size_t Count() const { return size; }
+    bool IsEmpty() const { return size == 0; }
+
+    /// @brief Calls visit(id) for every id, ascending, until it returns false.
+    template <typename Visit>
+    void ForEach(Visit visit) const {
+        for (size_t c = 0; c < containers.Count(); ++c) {
+            const Container* container = containers[c];
+            uint32_t base = static_cast<uint32_t>(container->key) << 16;
+
+            if (!container->IsBitset()) {
+                for (uint32_t i = 0; i < container->count; ++i) {
+                    if (!visit(base | container->values[i])) return;
+                }
+                continue;
+            }
+            for (uint32_t w = 0; w < BITSET_WORDS; ++w) {
+                for (uint64_t word = container->words[w]; word != 0; word &= word - 1) {
+                    if (!visit(base | (w << 6) | LowestBit(word))) return;
+                }
+            }
+        }
+    }
+
+    size_t ContainerCount() const { return containers.Count(); }
+    size_t BytesReserved() const;
+
+    /// @brief Index of the lowest set bit (word != 0).
+    static uint32_t LowestBit(uint64_t word) {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward64(&index, word);
+        return static_cast<uint32_t>(index);
+#else
+        return static_cast<uint32_t>(__builtin_ctzll(word));
+#endif
+    }
+
+    static uint32_t PopCount(uint64_t word) {
+#if defined(_MSC_VER)
+        return static_cast<uint32_t>(__popcnt64(word));
+#else
+        return static_cast<uint32_t>(__builtin_popcountll(word));
+#endif
+    }
+};
+
+#endif // !RoaringBitmap_h
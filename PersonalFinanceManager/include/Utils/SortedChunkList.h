@@ -0,0 +1,387 @@
+//
+//  SortedChunkList.h
+//  PersonalFinanceManager
+//
+
+#ifndef SortedChunkList_h
+#define SortedChunkList_h
+
+#include "ArrayList.h"
+
+#include <algorithm>
+#include <cstddef>
+
+/**
+ * @class SortedChunkList
+ * @brief Ordered collection stored as a list of fixed-size sorted chunks.
+ *
+ * A flat B+tree: the chunk directory is searched by each chunk's last item,
+ * then the chunk itself is binary-searched. Insert and Remove only shift
+ * items inside one chunk (at most CHUNK_CAPACITY), plus an occasional
+ * pointer shift in the directory when a chunk splits or empties, instead of
+ * moving the whole tail as a single sorted ArrayList does. Iteration walks
+ * contiguous chunks.
+ *
+ * Chunks start small (FIRST_CHUNK_CAPACITY) and double up to CHUNK_CAPACITY
+ * before they split, so the many short lists of a secondary index stay small.
+ *
+ * A Fenwick tree over the chunk sizes gives the number of items before any
+ * chunk in O(log chunks), so Rank never sums the directory. Item inserts and
+ * removals update it in O(log chunks); a split or fold, which already shifts
+ * the directory, rebuilds it in O(chunks).
+ *
+ * Items must be unique under Less (ties broken by the caller, e.g. with a
+ * sequence number) so Remove can find the exact element.
+ *
+ * @warning Iterators are invalidated by any Insert/Remove/Clear.
+ *
+ * @tparam T    Item type (typically a pointer).
+ * @tparam Less Strict weak ordering functor: bool operator()(const T&, const T&).
+ */
+template <typename T, typename Less>
+class SortedChunkList {
+public:
+    static constexpr size_t CHUNK_CAPACITY = 256;
+    static constexpr size_t FIRST_CHUNK_CAPACITY = 8;
+
+private:
+    struct Chunk {
+        T* items;
+        size_t count;
+        size_t capacity;
+
+        explicit Chunk(size_t cap) : items(new T[cap]), count(0), capacity(cap) { }
+        ~Chunk() { delete[] items; }
+
+        Chunk(const Chunk&) = delete;
+        Chunk& operator=(const Chunk&) = delete;
+
+        const T& Last() const { return items[count - 1]; }
+
+        /// @brief Grows (doubling, capped at CHUNK_CAPACITY) to hold 'needed' items.
+        void Reserve(size_t needed) {
+            if (needed <= capacity) return;
+
+            size_t cap = capacity;
+            while (cap < needed) cap *= 2;
+            if (cap > CHUNK_CAPACITY) cap = CHUNK_CAPACITY;
+
+            T* bigger = new T[cap];
+            std::copy(items, items + count, bigger);
+            delete[] items;
+            items = bigger;
+            capacity = cap;
+        }
+    };
+
+    ArrayList<Chunk*> chunks;
+    ArrayList<size_t> counts; // Fenwick nodes over chunk sizes: counts[i - 1] sums the (i & -i) chunks ending at chunk i - 1
+    size_t size;
+    Less less;
+
+    /**
+     * @brief Index of the chunk a value belongs to: the first chunk whose
+     * last item is not less than it, or the last chunk. List must be non-empty.
+     */
+    size_t FindChunk(const T& value) const {
+        size_t low = 0;
+        size_t high = chunks.Count();
+        while (low < high) {
+            size_t mid = low + (high - low) / 2;
+            if (less(chunks[mid]->Last(), value)) low = mid + 1;
+            else high = mid;
+        }
+        return (low == chunks.Count()) ? low - 1 : low;
+    }
+
+    /// @brief First chunk whose last item is not keyLess than 'key' (Count() if none).
+    template <typename Key, typename KeyLess>
+    size_t FindChunkBy(const Key& key, KeyLess keyLess) const {
+        size_t low = 0;
+        size_t high = chunks.Count();
+        while (low < high) {
+            size_t mid = low + (high - low) / 2;
+            if (keyLess(chunks[mid]->Last(), key)) low = mid + 1;
+            else high = mid;
+        }
+        return low;
+    }
+
+    /// @brief Items in the chunks before 'chunkIndex'. O(log chunks).
+    size_t CountBefore(size_t chunkIndex) const {
+        size_t sum = 0;
+        for (size_t i = chunkIndex; i > 0; i -= i & (~i + 1)) sum += counts[i - 1];
+        return sum;
+    }
+
+    /// @brief Records one item more (or fewer) in chunk 'chunkIndex'. O(log chunks).
+    void AdjustCount(size_t chunkIndex, bool add) {
+        for (size_t i = chunkIndex + 1; i <= counts.Count(); i += i & (~i + 1)) {
+            if (add) ++counts[i - 1];
+            else --counts[i - 1];
+        }
+    }
+
+    /// @brief Adds the node of a chunk just added at the end of the directory. O(log chunks).
+    void PushCount() {
+        size_t n = chunks.Count();
+        size_t covered = n & (~n + 1);
+        counts.Add(chunks[n - 1]->count + CountBefore(n - 1) - CountBefore(n - covered));
+    }
+
+    /// @brief Rebuilds every node after chunks were spliced in or out. O(chunks).
+    void RebuildCounts() {
+        size_t n = chunks.Count();
+        counts.Clear();
+        for (size_t i = 0; i < n; ++i) counts.Add(chunks[i]->count);
+        for (size_t i = 1; i <= n; ++i) {
+            size_t parent = i + (i & (~i + 1));
+            if (parent <= n) counts[parent - 1] += counts[i - 1];
+        }
+    }
+
+    size_t LowerBoundIn(const Chunk* chunk, const T& value) const {
+        return std::lower_bound(chunk->items, chunk->items + chunk->count, value, less) - chunk->items;
+    }
+
+    /// @brief Moves the upper half of a full chunk into a new chunk after it.
+    void Split(size_t chunkIndex) {
+        Chunk* left = chunks[chunkIndex];
+        Chunk* right = new Chunk(CHUNK_CAPACITY);
+
+        size_t half = left->count / 2;
+        std::copy(left->items + half, left->items + left->count, right->items);
+        right->count = left->count - half;
+        left->count = half;
+
+        chunks.Insert(chunkIndex + 1, right);
+        RebuildCounts();
+    }
+
+    /// @brief Drops an empty chunk, or folds a sparse one into a neighbour.
+    void Rebalance(size_t chunkIndex) {
+        Chunk* chunk = chunks[chunkIndex];
+        if (chunk->count == 0) {
+            delete chunk;
+            chunks.RemoveAt(chunkIndex);
+            RebuildCounts();
+            return;
+        }
+        if (chunk->count >= CHUNK_CAPACITY / 4) return;
+
+        // Fold into the previous chunk if it fits, else pull the next one in
+        if (chunkIndex > 0 && chunks[chunkIndex - 1]->count + chunk->count <= CHUNK_CAPACITY) {
+            Chunk* prev = chunks[chunkIndex - 1];
+            prev->Reserve(prev->count + chunk->count);
+            std::copy(chunk->items, chunk->items + chunk->count, prev->items + prev->count);
+            prev->count += chunk->count;
+            delete chunk;
+            chunks.RemoveAt(chunkIndex);
+            RebuildCounts();
+        }
+        else if (chunkIndex + 1 < chunks.Count() && chunks[chunkIndex + 1]->count + chunk->count <= CHUNK_CAPACITY) {
+            Chunk* next = chunks[chunkIndex + 1];
+            chunk->Reserve(chunk->count + next->count);
+            std::copy(next->items, next->items + next->count, chunk->items + chunk->count);
+            chunk->count += next->count;
+            delete next;
+            chunks.RemoveAt(chunkIndex + 1);
+            RebuildCounts();
+        }
+    }
+
+public:
+    /**
+     * @class Iterator
+     * @brief Bidirectional, read-only cursor over the items in order.
+     */
+    class Iterator {
+    private:
+        friend class SortedChunkList;
+
+        Chunk* const* chunk;
+        size_t pos;
+
+    public:
+        Iterator() : chunk(nullptr), pos(0) { }
+        Iterator(Chunk* const* c, size_t p) : chunk(c), pos(p) { }
+
+        const T& operator*() const { return (*chunk)->items[pos]; }
+
+        Iterator& operator++() {
+            if (++pos == (*chunk)->count) {
+                ++chunk;
+                pos = 0;
+            }
+            return *this;
+        }
+
+        /// @brief Steps back; valid from end() down to begin().
+        Iterator& operator--() {
+            if (pos == 0) {
+                --chunk;
+                pos = (*chunk)->count;
+            }
+            --pos;
+            return *this;
+        }
+
+        bool operator==(const Iterator& other) const { return chunk == other.chunk && pos == other.pos; }
+        bool operator!=(const Iterator& other) const { return !(*this == other); }
+    };
+
+    // ==========================================
+    // 1. CONSTRUCTORS & DESTRUCTOR
+    // ==========================================
+
+    SortedChunkList() : chunks(1), counts(1), size(0) { }
+
+    ~SortedChunkList() { Clear(); }
+
+    SortedChunkList(const SortedChunkList&) = delete;
+    SortedChunkList& operator=(const SortedChunkList&) = delete;
+
+    // ==========================================
+    // 2. MUTATION
+    // ==========================================
+
+    /// @brief Inserts in order. O(log N) search + O(CHUNK_CAPACITY) shift; O(1) past the end.
+    void Insert(const T& value) {
+        // Most inserts land after the last item (new records, index rebuilds)
+        if (chunks.IsEmpty() || less(chunks[chunks.Count() - 1]->Last(), value)) {
+            Append(value);
+            return;
+        }
+
+        size_t c = FindChunk(value);
+        Chunk* chunk = chunks[c];
+        size_t pos = LowerBoundIn(chunk, value);
+
+        if (chunk->count == CHUNK_CAPACITY) {
+            if (pos == CHUNK_CAPACITY && c == chunks.Count() - 1) {
+                // Appending past the end: start a fresh chunk, keep this one full
+                Chunk* tail = new Chunk(CHUNK_CAPACITY);
+                tail->items[tail->count++] = value;
+                chunks.Add(tail);
+                PushCount();
+                ++size;
+                return;
+            }
+
+            Split(c);
+            if (pos > chunk->count) {
+                pos -= chunk->count;
+                chunk = chunks[++c];
+            }
+        }
+        else {
+            chunk->Reserve(chunk->count + 1);
+        }
+
+        std::copy_backward(chunk->items + pos, chunk->items + chunk->count, chunk->items + chunk->count + 1);
+        chunk->items[pos] = value;
+        ++chunk->count;
+        AdjustCount(c, true);
+        ++size;
+    }
+
+    /**
+     * @brief Bulk-load helper: appends a value known to sort after every item.
+     * Chunks are packed full, so loading N sorted items costs N copies.
+     */
+    void Append(const T& value) {
+        if (chunks.IsEmpty() || chunks[chunks.Count() - 1]->count == CHUNK_CAPACITY) {
+            chunks.Add(new Chunk(chunks.IsEmpty() ? FIRST_CHUNK_CAPACITY : CHUNK_CAPACITY));
+            PushCount();
+        }
+
+        Chunk* tail = chunks[chunks.Count() - 1];
+        tail->Reserve(tail->count + 1);
+        tail->items[tail->count++] = value;
+        AdjustCount(chunks.Count() - 1, true);
+        ++size;
+    }
+
+    /// @brief Removes the item equal to 'value'. O(log N). Returns false if absent.
+    bool Remove(const T& value) {
+        if (chunks.IsEmpty()) return false;
+
+        size_t c = FindChunk(value);
+        Chunk* chunk = chunks[c];
+        size_t pos = LowerBoundIn(chunk, value);
+        if (pos == chunk->count || !(chunk->items[pos] == value)) return false;
+
+        std::copy(chunk->items + pos + 1, chunk->items + chunk->count, chunk->items + pos);
+        --chunk->count;
+        AdjustCount(c, false);
+        --size;
+
+        Rebalance(c);
+        return true;
+    }
+
+    void Clear() {
+        for (size_t i = 0; i < chunks.Count(); ++i) delete chunks[i];
+        chunks.Clear();
+        counts.Clear();
+        size = 0;
+    }
+
+    // ==========================================
+    // 3. SEARCH & ITERATION
+    // ==========================================
+
+    /**
+     * @brief First item for which keyLess(item, key) is false.
+     * Lets callers seek by a partial key (e.g. a Date) without building a T.
+     */
+    template <typename Key, typename KeyLess>
+    Iterator LowerBound(const Key& key, KeyLess keyLess) const {
+        size_t c = FindChunkBy(key, keyLess);
+        if (c == chunks.Count()) return end();
+
+        const Chunk* chunk = chunks[c];
+        size_t pos = std::lower_bound(chunk->items, chunk->items + chunk->count, key, keyLess) - chunk->items;
+        return Iterator(chunks.begin() + c, pos);
+    }
+
+    /**
+     * @brief Number of items for which keyLess(item, key) is true: the global
+     * position LowerBound would land on. Used to size a range without walking
+     * it. O(log N): the items before the chunk come from the size tree.
+     */
+    template <typename Key, typename KeyLess>
+    size_t Rank(const Key& key, KeyLess keyLess) const {
+        size_t c = FindChunkBy(key, keyLess);
+        if (c == chunks.Count()) return size;
+
+        const Chunk* chunk = chunks[c];
+        return CountBefore(c) + (std::lower_bound(chunk->items, chunk->items + chunk->count, key, keyLess) - chunk->items);
+    }
+
+    Iterator begin() const { return Iterator(chunks.begin(), 0); }
+    Iterator end() const { return Iterator(chunks.end(), 0); }
+
+    // ==========================================
+    // 4. STATE
+    // ==========================================
+
+    size_t Count() const { return size; }
+    bool IsEmpty() const { return size == 0; }
+
+    size_t ChunkCount() const { return chunks.Count(); }
+
+    /// @brief Item slots allocated across all chunks. O(chunk count).
+    size_t Capacity() const {
+        size_t total = 0;
+        for (size_t i = 0; i < chunks.Count(); ++i) total += chunks[i]->capacity;
+        return total;
+    }
+
+    /// @brief Heap bytes held by the chunks, the chunk directory and the size tree. O(chunk count).
+    size_t BytesReserved() const {
+        return chunks.BytesReserved() + counts.BytesReserved() + chunks.Count() * sizeof(Chunk) + Capacity() * sizeof(T);
+    }
+};
+
+#endif // !SortedChunkList_h
@@ -0,0 +1,94 @@
+//
+//  StringArena.h
+//  PersonalFinanceManager
+//
+
+#ifndef StringArena_h
+#define StringArena_h
+
+#include <cstdint>
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+
+/**
+ * @struct StringRef
+ * @brief Handle to a string stored in a StringArena (offset + length).
+ * Trivially copyable, so records holding it can be copied with memcpy.
+ */
+struct StringRef {
+    uint32_t offset;
+    uint32_t length;
+};
+
+/**
+ * @class StringArena
+ * @brief Append-only character buffer that owns many short strings.
+ *
+ * Strings are appended back to back into one growing block, so a whole
+ * generation of strings costs a handful of allocations and is freed at once.
+ * Replaced or removed strings are only marked dead; Compact() into a fresh
+ * arena reclaims the space.
+ */
+class StringArena {
+private:
+    char* data;
+    size_t size;
+    size_t capacity;
+    size_t deadBytes;
+
+    static const size_t DEFAULT_CAPACITY = 4096;
+
+    void Reserve(size_t required);
+
+public:
+    // ==========================================
+    // 1. CONSTRUCTORS & DESTRUCTOR
+    // ==========================================
+    StringArena();
+    explicit StringArena(size_t initCap);
+    ~StringArena();
+
+    StringArena(const StringArena&) = delete;
+    StringArena& operator=(const StringArena&) = delete;
+
+    // ==========================================
+    // 2. APPEND & ACCESS
+    // ==========================================
+    StringRef Append(const char* str, size_t length);
+    StringRef Append(const std::string& str) { return Append(str.data(), str.size()); }
+
+    /// @brief Reads 'length' bytes straight from a stream into the arena.
+    StringRef AppendFromStream(std::istream& in, size_t length);
+
+    /// @brief Marks a string as no longer referenced (space reclaimed on Compact).
+    void Release(StringRef ref) { deadBytes += ref.length; }
+
+    const char* Data(StringRef ref) const { return data + ref.offset; }
+
+    /// @brief Every string back to back, dead ones included (Size() bytes).
+    const char* Buffer() const { return data; }
+    std::string Get(StringRef ref) const { return std::string(data + ref.offset, ref.length); }
+
+    // ==========================================
+    // 3. GENERATION MANAGEMENT
+    // ==========================================
+
+    /// @brief Drops every string (keeps the block for reuse).
+    void Clear();
+
+    /// @brief Frees the block entirely.
+    void Reset();
+
+    /// @brief True once dead strings take up a quarter of the buffer.
+    bool NeedsCompaction() const { return deadBytes > 0 && deadBytes * 4 >= size; }
+
+    void Swap(StringArena& other);
+
+    size_t Size() const { return size; }
+    size_t Capacity() const { return capacity; }
+    size_t LiveBytes() const { return size - deadBytes; }
+    size_t DeadBytes() const { return deadBytes; }
+};
+
+#endif // !StringArena_h
@@ -0,0 +1,88 @@
+//
+//  TDigest.h
+//  PersonalFinanceManager
+//
+
+#ifndef TDigest_h
+#define TDigest_h
+
+#include <cstddef>
+
+/**
+ * @class TDigest
+ * @brief Approximate quantiles of a stream of values in fixed memory (merging t-digest).
+ *
+ * Values are summarized as weighted centroids (mean, weight). New values
+ * go to a buffer; when it fills, buffer and centroids are sorted by mean
+ * and neighbours are merged greedily while the merged centroid stays
+ * within one unit of the scale function k(q) = C / (2 pi) * asin(2q - 1).
+ * That keeps centroids near the tails small (so p1 / p99 stay accurate)
+ * and lets those near the median grow, with at most about C centroids
+ * whatever the stream length. Memory is fixed at construction.
+ *
+ * The smallest and largest values are kept exactly, so Quantile(0) and
+ * Quantile(1) are exact.
+ */
+class TDigest {
+public:
+    /// Default compression C: about 1% rank error near the median, far less at the tails.
+    static constexpr size_t DEFAULT_COMPRESSION = 100;
+
+private:
+    struct Centroid {
+        double mean;
+        double weight;
+    };
+
+    Centroid* centroids; // Merged centroids, sorted by mean, then the unmerged buffer
+    size_t merged;       // Merged centroids at the front
+    size_t buffered;     // Values in the buffer after them
+    size_t capacity;     // Merged + buffer slots
+    double compression;
+    double totalWeight;
+    double minValue;
+    double maxValue;
+
+    void Compress();
+    double QuantileLimit(double q) const;
+
+public:
+    // ==========================================
+    // 1. CONSTRUCTOR & DESTRUCTOR
+    // ==========================================
+    explicit TDigest(size_t compression = DEFAULT_COMPRESSION);
+    ~TDigest();
+
+    TDigest(const TDigest&) = delete;
+    TDigest& operator=(const TDigest&) = delete;
+
+    // ==========================================
+    // 2. UPDATES
+    // ==========================================
+    void Add(double value, double weight = 1);
+
+    /// @brief Adds every centroid of 'other' (e.g. a partial built by another thread).
+    void Merge(TDigest& other);
+
+    void Clear();
+
+    // ==========================================
+    // 3. QUERIES
+    // ==========================================
+
+    /// @brief Estimated value at rank q * Count() (q in [0, 1]); 0 for an empty digest.
+    double Quantile(double q);
+
+    size_t Count() const { return static_cast<size_t>(totalWeight); }
+    bool IsEmpty() const { return totalWeight == 0; }
+    double Min() const { return totalWeight == 0 ? 0 : minValue; }
+    double Max() const { return totalWeight == 0 ? 0 : maxValue; }
+
+    // ==========================================
+    // 4. DIAGNOSTICS
+    // ==========================================
+    size_t CentroidCount();
+    size_t BytesReserved() const { return capacity * sizeof(Centroid); }
+};
+
+#endif // !TDigest_h
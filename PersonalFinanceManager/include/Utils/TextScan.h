@@ -0,0 +1,45 @@
+//
+//  TextScan.h
+//  PersonalFinanceManager
+//
+
+#ifndef TextScan_h
+#define TextScan_h
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class TextScan
+ * @brief Vectorized substring search for description text.
+ *
+ * The kernels compare the needle's first and last bytes against 16 (SSE2) or
+ * 32 (AVX2) candidate positions at once and only compare the middle bytes
+ * where both agree. AVX2 is picked at run time when the CPU has it; builds
+ * with PFM_NO_AVX2 defined stop at SSE2, and other targets, or builds with
+ * PFM_NO_SIMD defined, use a scalar loop.
+ * The case-insensitive variants fold ASCII letters only.
+ */
+class TextScan {
+public:
+    /// @brief True if 'needle' occurs in 'text'. An empty needle always matches.
+    static bool Contains(const char* text, size_t length, const char* needle, size_t needleLength, bool ignoreCase);
+
+    /**
+     * @brief Sets bit i of 'marks' for every offset i where 'needle' starts
+     * (overlapping matches included) and returns how many were set.
+     * 'marks' must hold MarkWords(length) words, zeroed by the caller.
+     * Meant for one pass over many strings stored back to back.
+     */
+    static size_t MarkAll(const char* text, size_t length, const char* needle, size_t needleLength, bool ignoreCase, uint64_t* marks);
+
+    static size_t MarkWords(size_t length) { return (length + 63) / 64; }
+
+    /// @brief True if any bit in [first, last] is set.
+    static bool AnyMarked(const uint64_t* marks, size_t first, size_t last);
+
+    /// @brief Kernel in use on this machine: "avx2", "sse2" or "scalar".
+    static const char* KernelName();
+};
+
+#endif // !TextScan_h
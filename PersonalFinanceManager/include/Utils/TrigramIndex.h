@@ -0,0 +1,125 @@
+//
+//  TrigramIndex.h
+//  PersonalFinanceManager
+//
+
+#ifndef TrigramIndex_h
+#define TrigramIndex_h
+
+#include "ArrayList.h"
+#include "HashMap.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class TrigramIndex
+ * @brief Substring and typo-tolerant search over short texts (descriptions).
+ *
+ * Every 3-byte window of a text (ASCII letters folded to lowercase) maps to
+ * the ascending list of slot ids whose text contains it. Lists are stored as
+ * varint-encoded gaps, so a posting usually costs one byte.
+ *
+ * The index only narrows the search: the candidates it returns are a
+ * superset of the matches and the caller verifies each one against the real
+ * text. Slots whose text is gone can therefore stay in the lists until the
+ * owner rebuilds the index.
+ */
+class TrigramIndex {
+public:
+    /// Edit-distance bound accepted by fuzzy searches.
+    static constexpr int MAX_EDITS = 3;
+
+    /// Longest fuzzy pattern (bytes); longer patterns are cut by the caller.
+    static constexpr size_t MAX_FUZZY_LENGTH = 64;
+
+private:
+    /**
+     * @struct PostingList
+     * @brief Ascending slot ids as varint gaps (7 bits per byte, high bit = more).
+     */
+    struct PostingList {
+        uint8_t* bytes;
+        uint32_t length;
+        uint32_t capacity;
+        uint32_t count;
+        uint32_t last;
+
+        PostingList() : bytes(nullptr), length(0), capacity(0), count(0), last(0) { }
+        ~PostingList() { delete[] bytes; }
+
+        void Append(uint32_t slot);
+
+        /// @brief Calls visit(slot) for every slot, ascending.
+        template <typename Visit>
+        void ForEach(Visit visit) const {
+            uint32_t slot = 0, shift = 0, gap = 0;
+            for (uint32_t i = 0; i < length; ++i) {
+                gap |= static_cast<uint32_t>(bytes[i] & 0x7F) << shift;
+                if (bytes[i] & 0x80) {
+                    shift += 7;
+                    continue;
+                }
+                slot += gap;
+                visit(slot);
+                gap = 0;
+                shift = 0;
+            }
+        }
+    };
+
+    HashMap<int, PostingList*>* lists;
+    size_t postings;
+    ArrayList<int> scratch; // Keys of the text being added
+
+    static int Key(const char* window);
+    static void Keys(const char* text, size_t length, ArrayList<int>& out); // Distinct, sorted
+    void Lookup(const char* pattern, size_t length, ArrayList<const PostingList*>& out, size_t& missing) const;
+
+public:
+    // ==========================================
+    // 1. CONSTRUCTOR & DESTRUCTOR
+    // ==========================================
+    TrigramIndex();
+    ~TrigramIndex();
+
+    // ==========================================
+    // 2. UPDATES
+    // ==========================================
+
+    /// @brief Indexes 'text' under 'slot', which must be larger than every slot added so far.
+    void Add(uint32_t slot, const char* text, size_t length);
+
+    void Clear();
+
+    // ==========================================
+    // 3. SEARCH
+    // ==========================================
+
+    /**
+     * @brief Slots that may hold 'pattern' with at most 'maxEdits' edits.
+     * @return false if the pattern is too short for the index to narrow
+     *         anything down (the caller must scan); 'out' is then untouched.
+     */
+    bool Candidates(const char* pattern, size_t length, int maxEdits, ArrayList<uint32_t>& out) const;
+
+    /// @brief Upper bound on Candidates() without decoding any list; false as above.
+    bool EstimateCandidates(const char* pattern, size_t length, int maxEdits, size_t& rows) const;
+
+    /**
+     * @brief True if some substring of 'text' is within 'maxEdits' insertions,
+     * deletions or substitutions of 'pattern' (ASCII case-insensitive).
+     * At most MAX_FUZZY_LENGTH pattern bytes; nothing is allocated.
+     */
+    static bool ContainsApproximately(const char* text, size_t length, const char* pattern, size_t patternLength, int maxEdits);
+
+    // ==========================================
+    // 4. DIAGNOSTICS
+    // ==========================================
+    size_t TrigramCount() const { return lists->Count(); }
+    size_t PostingCount() const { return postings; }
+    size_t BytesReserved() const;
+    size_t BytesUnused() const; // Posting-list headroom
+};
+
+#endif // !TrigramIndex_h
@@ -19,6 +19,12 @@ public:
     /// @brief Prompts user for an optional date, blank returns invalid Date
     static Date GetOptionalDate(const std::string& prompt);
 
+    /// @brief Prompts user for an optional amount (>= 0), blank returns 0
+    static double GetOptionalMoney(const std::string& prompt);
+
+    /// @brief Prompts user for optional text, blank returns an empty string
+    static std::string GetOptionalString(const std::string& prompt);
+
     /// @brief Prompts user for string input and validates it's not empty
     /// @param prompt Message to display to user
     /// @return std::string if valid, keeps asking until valid input
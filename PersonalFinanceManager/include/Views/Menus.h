@@ -84,6 +84,9 @@ public:
     static const std::string REPORTS_MENU_3;
     static const std::string REPORTS_MENU_4;
     static const std::string REPORTS_MENU_5;
+    static const std::string REPORTS_MENU_6;
+    static const std::string REPORTS_MENU_7;
+    static const std::string REPORTS_MENU_8;
     
     // Add Income Form
     static const std::string ADD_INCOME_TITLE;
@@ -118,6 +121,7 @@ public:
     static const std::string SEARCH_MENU_4;
     static const std::string SEARCH_MENU_5;
     static const std::string SEARCH_MENU_6;
+    static const std::string SEARCH_MENU_7;
 };
 
 #endif // !Menus_h
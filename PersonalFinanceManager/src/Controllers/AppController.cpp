@@ -11,11 +11,10 @@
 // Include Utils
 #include "Utils/IdGenerator.h"
 #include "Utils/AppHelpers.h"
+#include "Utils/TextScan.h"
 
 // Include Models
 #include "Models/Transaction.h"
-#include "Models/Income.h"
-#include "Models/Expense.h"
 #include "Models/Wallet.h"
 #include "Models/Category.h"
 #include "Models/IncomeSource.h"
@@ -25,6 +24,8 @@
 #include <fstream>
 #include <iomanip>
 #include <algorithm>
+#include <cmath>
+#include <climits>
 
 // --- FILE PATH CONSTANTS ---
 const std::string FILE_WALLETS = "data/wallets.bin";
@@ -36,15 +37,28 @@ const std::string FILE_RECURRING = "data/recurring.bin";
 // Auto-save interval
 const int AUTO_SAVE_INTERVAL = 60;
 
+// The slot table and trigram index are rebuilt once this many slots, and over half of all slots, are vacant
+const size_t SLOT_REBUILD_MIN_VACANT = 1024;
+
+// Widest date range (in months) whose month bitmaps a bitmap selection ORs together
+const int BITMAP_MAX_MONTHS = 36;
+
+// Walks shorter than this cost about as much as intersecting bitmaps, so they skip them
+const size_t BITMAP_MIN_ROWS = 1024;
+
+// A keyword scan walking at least 1/8 of the rows searches the whole description arena in one pass first
+const size_t ARENA_SCAN_MIN_SHARE = 8;
+
 using namespace AppHelpers;
 
 // Autosave
 
 void AppController::AutoSaveWorker() {
-    while (!stopAutoSave) {
-        for (int i = 0; i < AUTO_SAVE_INTERVAL; ++i) {
-            if (stopAutoSave) return;
-            std::this_thread::sleep_for(std::chrono::seconds(1));
+    while (true) {
+        {
+            std::unique_lock<std::mutex> wait(autoSaveMutex);
+            if (autoSaveWake.wait_for(wait, std::chrono::seconds(AUTO_SAVE_INTERVAL), [this] { return stopAutoSave.load(); }))
+                return;
         }
 
         ShowAutoSaveIndicator();
@@ -71,24 +85,143 @@ void AppController::ShowAutoSaveIndicator() {
 
 void AppController::AddTransactionToIndex(Transaction* t) {
 
-    AddToIndexMap(walletIndex, t->GetWalletId(), t);
+    AddToIndexMap(walletIndex, t->GetWalletKey(), t);
+    AdjustUsage(t->GetWalletKey(), +1, 0);
 
     if (t->GetType() == TransactionType::Expense)
-        AddToIndexMap(categoryIndex, t->GetCategoryId(), t);
+        AddToIndexMap(categoryIndex, t->GetCategoryKey(), t);
     
     if (t->GetType() == TransactionType::Income)
-        AddToIndexMap(incomeSourceIndex, t->GetCategoryId(), t);
+        AddToIndexMap(incomeSourceIndex, t->GetCategoryKey(), t);
+
+    AdjustUsage(t->GetCategoryKey(), +1, 0);
+
+    TrackTotals(t, +1);
+    AssignSlot(t);
 }
 
 void AppController::RemoveTransactionFromIndex(Transaction* t) {
 
-    RemoveFromIndexMap(walletIndex, t->GetWalletId(), t);
+    RemoveFromIndexMap(walletIndex, t->GetWalletKey(), t);
+    AdjustUsage(t->GetWalletKey(), -1, 0);
 
     if (t->GetType() == TransactionType::Expense)
-        RemoveFromIndexMap(categoryIndex, t->GetCategoryId(), t);
+        RemoveFromIndexMap(categoryIndex, t->GetCategoryKey(), t);
     
     if (t->GetType() == TransactionType::Income)
-        RemoveFromIndexMap(incomeSourceIndex, t->GetCategoryId(), t);
+        RemoveFromIndexMap(incomeSourceIndex, t->GetCategoryKey(), t);
+
+    AdjustUsage(t->GetCategoryKey(), -1, 0);
+
+    TrackTotals(t, -1);
+    VacateSlot(t);
+}
+
+// --- Row Slots (trigram index + column bitmaps) ---
+
+static int MonthKey(const Date& d) { return d.GetYear() * 12 + d.GetMonth() - 1; }
+
+void AppController::AssignSlot(Transaction* t) {
+    uint32_t slot = static_cast<uint32_t>(slots->Count());
+    t->SetSlot(slot);
+    slots->Add(t);
+    slotAmounts->Add(t->GetAmount());
+
+    std::string_view text = t->GetDescriptionView(*descriptions);
+    textIndex->Add(slot, text.data(), text.size());
+
+    typeRows->Add(static_cast<int>(t->GetType()), slot);
+    walletRows->Add(t->GetWalletKey(), slot);
+    categoryRows->Add(t->GetCategoryKey(), slot);
+    monthRows->Add(MonthKey(t->GetDate()), slot);
+}
+
+void AppController::VacateSlot(Transaction* t) {
+    uint32_t slot = t->GetSlot();
+    typeRows->Remove(static_cast<int>(t->GetType()), slot);
+    walletRows->Remove(t->GetWalletKey(), slot);
+    categoryRows->Remove(t->GetCategoryKey(), slot);
+    monthRows->Remove(MonthKey(t->GetDate()), slot);
+    reportCache->Invalidate(MonthKey(t->GetDate()));
+
+    (*slots)[slot] = nullptr;
+    ++vacantSlots;
+}
+
+void AppController::CompactSlots() {
+    if (vacantSlots < SLOT_REBUILD_MIN_VACANT || vacantSlots * 2 < slots->Count()) return;
+
+    slots->Clear();
+    slotAmounts->Clear();
+    vacantSlots = 0;
+    textIndex->Clear();
+    typeRows->Clear();
+    walletRows->Clear();
+    categoryRows->Clear();
+    monthRows->Clear();
+    for (Transaction* t : *transactions) {
+        AssignSlot(t);
+    }
+}
+
+// --- Usage Counters ---
+// Wallet, category and source IDs carry distinct prefixes, so one map holds all three.
+
+void AppController::AdjustUsage(const EntityId& key, int transactions, int recurring) {
+    if (key.IsEmpty()) return;
+
+    EntityUsage& usage = (*usageCounts)[key];
+    usage.transactions += transactions;
+    usage.recurring += recurring;
+}
+
+void AppController::TrackRecurringUsage(RecurringTransaction* rt, int delta) {
+    AdjustUsage(EntityId::FromString(rt->GetWalletId()), 0, delta);
+    AdjustUsage(EntityId::FromString(rt->GetCategoryId()), 0, delta);
+}
+
+// --- Monthly Rollup & Daily Totals ---
+
+void AppController::TrackTotals(Transaction* t, int delta) {
+    RollupKey key(static_cast<int>(t->GetType()), t->GetWalletKey(), t->GetCategoryKey());
+    FenwickTree<QueryTotals>* daily = dailyTotals[static_cast<int>(t->GetType())];
+    long long day = t->GetDate().DayNumber();
+
+    FenwickTree<WalletFlow>*& walletFlow = (*walletDailyFlow)[t->GetWalletKey()];
+    if (walletFlow == nullptr) walletFlow = new FenwickTree<WalletFlow>();
+    WalletFlow flow = (t->GetType() == TransactionType::Income) ? WalletFlow(t->GetAmount(), 0) : WalletFlow(0, t->GetAmount());
+
+    // Cached reports over this month are stale (description edits go through VacateSlot)
+    reportCache->Invalidate(MonthKey(t->GetDate()));
+
+    if (delta > 0) {
+        rollup->Add(MonthKey(t->GetDate()), key, t->GetAmount());
+        daily->Add(day, QueryTotals(1, t->GetAmount()));
+        walletFlow->Add(day, flow);
+    }
+    else {
+        rollup->Remove(MonthKey(t->GetDate()), key, t->GetAmount());
+        daily->Subtract(day, QueryTotals(1, t->GetAmount()));
+        walletFlow->Subtract(day, flow);
+    }
+}
+
+EntityUsage AppController::GetUsage(const std::string& id) {
+    std::lock_guard<std::recursive_mutex> lock(dataMutex);
+    EntityUsage* usage = usageCounts->Get(EntityId::FromString(id));
+    return (usage != nullptr) ? *usage : EntityUsage{0, 0};
+}
+
+// --- Description Arena ---
+
+void AppController::CompactDescriptions() {
+    if (!descriptions->NeedsCompaction()) return;
+
+    StringArena compacted(descriptions->LiveBytes());
+    for (Transaction* t : *transactions) {
+        t->MoveDescription(*descriptions, compacted);
+    }
+    descriptions->Swap(compacted);
 }
 
 // ==========================================
@@ -97,26 +230,49 @@ void AppController::RemoveTransactionFromIndex(Transaction* t) {
 
 AppController::AppController(ConsoleView* v) : view(v) {
 
-    this->transactions = new ArrayList<Transaction*>();
+    this->transactionStore = new Region<Transaction>();
+    this->descriptions = new StringArena();
+    this->transactions = new TransactionLedger();
+    this->amountIndex = new TransactionAmountIndex();
+    this->nextSequence = 0;
+    this->dataGeneration = 0;
     this->recurringTransactions = new ArrayList<RecurringTransaction*>();
     this->walletsList = new ArrayList<Wallet*>();
     this->categoriesList = new ArrayList<Category*>();
     this->incomeSourcesList = new ArrayList<IncomeSource*>();
 
-    this->walletsMap = new HashMap<std::string, Wallet*>();
-    this->categoriesMap = new HashMap<std::string, Category*>();
-    this->incomeSourcesMap = new HashMap<std::string, IncomeSource*>();
-    this->transactionsMap = new HashMap<std::string, Transaction*>();
-    this->recurringTransactionsMap = new HashMap<std::string, RecurringTransaction*>();
+    this->walletsMap = new HashMap<EntityId, Wallet*>();
+    this->categoriesMap = new HashMap<EntityId, Category*>();
+    this->incomeSourcesMap = new HashMap<EntityId, IncomeSource*>();
+    this->transactionsMap = new HashMap<EntityId, Transaction*>();
+    this->recurringTransactionsMap = new HashMap<EntityId, RecurringTransaction*>();
 
     LoadData();
 
-    this->walletIndex = new HashMap<std::string, ArrayList<Transaction*>*>();
-    this->categoryIndex = new HashMap<std::string, ArrayList<Transaction*>*>();
-    this->incomeSourceIndex = new HashMap<std::string, ArrayList<Transaction*>*>();
-
-    for (size_t i = 0; i < transactions->Count(); ++i) {
-        AddTransactionToIndex(transactions->Get(i));
+    this->walletIndex = new HashMap<EntityId, TransactionLedger*>();
+    this->categoryIndex = new HashMap<EntityId, TransactionLedger*>();
+    this->incomeSourceIndex = new HashMap<EntityId, TransactionLedger*>();
+    this->slots = new ArrayList<Transaction*>();
+    this->slotAmounts = new ArrayList<double>();
+    this->vacantSlots = 0;
+    this->textIndex = new TrigramIndex();
+    this->typeRows = new BitmapIndex<int>();
+    this->walletRows = new BitmapIndex<EntityId>();
+    this->categoryRows = new BitmapIndex<EntityId>();
+    this->monthRows = new BitmapIndex<int>();
+    this->planRows = new RoaringBitmap();
+    this->planRowsExact = false;
+    this->rollup = new MonthlyRollup();
+    for (FenwickTree<QueryTotals>*& daily : dailyTotals) daily = new FenwickTree<QueryTotals>();
+    this->walletDailyFlow = new HashMap<EntityId, FenwickTree<WalletFlow>*>();
+    this->reportCache = new ReportCache();
+    this->usageCounts = new HashMap<EntityId, EntityUsage>();
+
+    for (Transaction* t : *transactions) {
+        AddTransactionToIndex(t);
+    }
+    for (size_t i = 0; i < recurringTransactions->Count(); ++i) {
+        TrackRecurringUsage(recurringTransactions->Get(i), +1);
     }
     
     ProcessRecurringTransactions();
@@ -126,7 +282,11 @@ AppController::AppController(ConsoleView* v) : view(v) {
 }
 
 AppController::~AppController() {
-    stopAutoSave = true;
+    {
+        std::lock_guard<std::mutex> wait(autoSaveMutex);
+        stopAutoSave = true;
+    }
+    autoSaveWake.notify_all();
     if (autoSaveThread.joinable()) {
         autoSaveThread.join();
     }
@@ -136,8 +296,27 @@ AppController::~AppController() {
     ClearIndexMap(walletIndex);
     ClearIndexMap(categoryIndex);
     ClearIndexMap(incomeSourceIndex);
+    delete slots;
+    delete slotAmounts;
+    delete textIndex;
+    delete typeRows;
+    delete walletRows;
+    delete categoryRows;
+    delete monthRows;
+    delete planRows;
+    delete rollup;
+    for (FenwickTree<QueryTotals>* daily : dailyTotals) delete daily;
+    FreeMapValues(walletDailyFlow);
+    delete walletDailyFlow;
+    delete reportCache;
+    delete usageCounts;
+    
+    // Transactions and their descriptions go in a few block frees
+    delete transactions;
+    delete amountIndex;
+    delete transactionStore;
+    delete descriptions;
     
-    FreeList(transactions);
     FreeList(recurringTransactions);
     FreeList(walletsList);
     FreeList(categoriesList);
@@ -159,10 +338,14 @@ AppController::~AppController() {
 void AppController::SaveData(bool silent) {
     std::lock_guard<std::recursive_mutex> lock(dataMutex);
 
+    // Reclaim edited/deleted descriptions on explicit saves only; the
+    // auto-save thread must not move strings the UI may be reading.
+    if (!silent) CompactDescriptions();
+
     SaveTable(FILE_CATEGORIES, categoriesList);
     SaveTable(FILE_SOURCES, incomeSourcesList);
     SaveTable(FILE_WALLETS, walletsList);
-    SaveTable(FILE_TRANSACTIONS, transactions);
+    SaveTable(FILE_TRANSACTIONS, transactions, *descriptions);
     SaveTable(FILE_RECURRING, recurringTransactions);
     
     if (!silent && view) {
@@ -172,12 +355,39 @@ void AppController::SaveData(bool silent) {
     }
 }
 
+void AppController::LoadTransactions() {
+    ArrayList<Transaction*> loaded;
+    LoadTable(FILE_TRANSACTIONS, &loaded, transactionsMap, transactionStore, *descriptions);
+
+    // File order breaks ties between equal dates. Saved files are already in
+    // ledger order, so the sort only runs for files written out of order.
+    for (Transaction* t : loaded) t->SetSequence(nextSequence++);
+    if (!std::is_sorted(loaded.begin(), loaded.end(), TransactionOrder()))
+        std::sort(loaded.begin(), loaded.end(), TransactionOrder());
+
+    ++dataGeneration;
+    bool bulk = transactions->IsEmpty();
+    for (Transaction* t : loaded) {
+        if (bulk) transactions->Append(t);
+        else transactions->Insert(t);
+    }
+
+    // Amount index: one sort of the pointers, then packed appends
+    if (bulk) {
+        std::sort(loaded.begin(), loaded.end(), TransactionAmountOrder());
+        for (Transaction* t : loaded) amountIndex->Append(t);
+    }
+    else {
+        for (Transaction* t : loaded) amountIndex->Insert(t);
+    }
+}
+
 void AppController::LoadData() {
 
     LoadTable(FILE_CATEGORIES, categoriesList, categoriesMap);
     LoadTable(FILE_SOURCES, incomeSourcesList, incomeSourcesMap);
     LoadTable(FILE_WALLETS, walletsList, walletsMap);
-    LoadTable(FILE_TRANSACTIONS, transactions, transactionsMap);
+    LoadTransactions();
     LoadTable(FILE_RECURRING, recurringTransactions, recurringTransactionsMap);
     
     if (view) view->ShowSuccess("Data loaded from disk.");
@@ -203,13 +413,15 @@ void AppController::AddWallet(const std::string& name, double initialBalance) {
 
     std::string prefix = EnumHelper::IdPrefixToString(IdPrefix::Wallet);
     std::string newId;
+    EntityId key;
     do {
         newId = IdGenerator::GenerateId(prefix);
-    } while (walletsMap->ContainsKey(newId));
+        key = EntityId::FromString(newId);
+    } while (walletsMap->ContainsKey(key));
 
     Wallet* newWallet = new Wallet(newId, name, initialBalance);
 
-    walletsMap->Put(newId, newWallet);
+    walletsMap->Put(key, newWallet);
     walletsList->Add(newWallet);
     
     if (view) view->ShowSuccess("Wallet created: " + name);
@@ -217,7 +429,7 @@ void AppController::AddWallet(const std::string& name, double initialBalance) {
 
 Wallet* AppController::GetWalletById(const std::string& id) {
     std::lock_guard<std::recursive_mutex> lock(dataMutex);
-    Wallet** w = walletsMap->Get(id);
+    Wallet** w = walletsMap->Get(EntityId::FromString(id));
     return (w != nullptr) ? *w : nullptr;
 }
 
@@ -230,6 +442,32 @@ double AppController::GetTotalBalance() const {
     return total;
 }
 
+double AppController::GetWalletBalanceAt(const std::string& walletId, const Date& date) {
+    std::lock_guard<std::recursive_mutex> lock(dataMutex);
+    Wallet* w = GetWalletById(walletId);
+    if (w == nullptr) return 0;
+
+    // Every balance change is a transaction, so undo the ones dated after 'date'
+    FenwickTree<WalletFlow>** flow = walletDailyFlow->Get(EntityId::FromString(walletId));
+    if (flow == nullptr) return w->GetBalance();
+    return w->GetBalance() - (*flow)->Sum(date.DayNumber() + 1, LLONG_MAX).Net();
+}
+
+WalletStats AppController::GetWalletStats(const std::string& walletId, const Date& today) {
+    std::lock_guard<std::recursive_mutex> lock(dataMutex);
+    EntityId key = EntityId::FromString(walletId);
+    WalletStats stats = { 0, WalletFlow() };
+
+    EntityUsage* usage = usageCounts->Get(key);
+    if (usage != nullptr) stats.transactions = usage->transactions;
+
+    FenwickTree<WalletFlow>** flow = walletDailyFlow->Get(key);
+    if (flow != nullptr) {
+        stats.monthToDate = (*flow)->Sum(Date(1, today.GetMonth(), today.GetYear()).DayNumber(), today.DayNumber());
+    }
+    return stats;
+}
+
 // ==========================================
 // 4. MASTER DATA LOGIC (BASIC)
 // ==========================================
@@ -243,12 +481,14 @@ void AppController::AddCategory(const std::string& name) {
 
     std::string prefix = EnumHelper::IdPrefixToString(IdPrefix::Category);
     std::string id;
+    EntityId key;
     do {
         id = IdGenerator::GenerateId(prefix);
-    } while (categoriesMap->ContainsKey(id));
+        key = EntityId::FromString(id);
+    } while (categoriesMap->ContainsKey(key));
     
     Category* obj = new Category(id, name);
-    categoriesMap->Put(id, obj);
+    categoriesMap->Put(key, obj);
     categoriesList->Add(obj);
 
     if (view) view->ShowSuccess("Category created: " + name);
@@ -256,7 +496,7 @@ void AppController::AddCategory(const std::string& name) {
 
 Category* AppController::GetCategoryById(const std::string& id) {
     std::lock_guard<std::recursive_mutex> lock(dataMutex);
-    Category** c = categoriesMap->Get(id);
+    Category** c = categoriesMap->Get(EntityId::FromString(id));
     return (c != nullptr) ? *c : nullptr;
 }
 
@@ -269,12 +509,14 @@ void AppController::AddIncomeSource(const std::string& name) {
     
     std::string prefix = EnumHelper::IdPrefixToString(IdPrefix::IncomeSource);
     std::string id;
+    EntityId key;
     do {
         id = IdGenerator::GenerateId(prefix);
-    } while (incomeSourcesMap->ContainsKey(id));
+        key = EntityId::FromString(id);
+    } while (incomeSourcesMap->ContainsKey(key));
     
     IncomeSource* obj = new IncomeSource(id, name);
-    incomeSourcesMap->Put(id, obj);
+    incomeSourcesMap->Put(key, obj);
     incomeSourcesList->Add(obj);
 
     if (view) view->ShowSuccess("Income Source created: " + name);
@@ -282,7 +524,7 @@ void AppController::AddIncomeSource(const std::string& name) {
 
 IncomeSource* AppController::GetIncomeSourceById(const std::string& id) {
     std::lock_guard<std::recursive_mutex> lock(dataMutex);
-    IncomeSource** s = incomeSourcesMap->Get(id);
+    IncomeSource** s = incomeSourcesMap->Get(EntityId::FromString(id));
     return (s != nullptr) ? *s : nullptr;
 }
 
@@ -317,47 +559,42 @@ void AppController::AddTransaction(double amount, std::string walletId, std::str
 
     std::string prefix = EnumHelper::IdPrefixToString(IdPrefix::Transaction);
     std::string transId;
+    EntityId transKey;
     do {
         transId = IdGenerator::GenerateId(prefix);
-    } while (transactionsMap->ContainsKey(transId));
+        transKey = EntityId::FromString(transId);
+    } while (transactionsMap->ContainsKey(transKey));
 
-    Transaction* newTrans = nullptr;
+    Transaction* newTrans = transactionStore->Allocate(*descriptions, transId, walletId, categoryOrSourceId, amount, type, date, description);
 
     if (type == TransactionType::Income) {
-        newTrans = new Income(transId, walletId, categoryOrSourceId, amount, date, description);
         wallet->AddAmount(amount);
     } else {
-        newTrans = new Expense(transId, walletId, categoryOrSourceId, amount, date, description);
         wallet->SubtractAmount(amount);
     }
     
-    size_t insertPos = GetSortedInsertIndex(transactions, newTrans->GetDate());
-    transactions->Insert(insertPos, newTrans);
+    ++dataGeneration;
+    newTrans->SetSequence(nextSequence++);
+    transactions->Insert(newTrans);
+    amountIndex->Insert(newTrans);
     
 
     AddTransactionToIndex(newTrans); 
-    transactionsMap->Put(transId, newTrans);
+    transactionsMap->Put(transKey, newTrans);
     
     if (view) view->ShowSuccess("Transaction added. New Wallet Balance: " + std::to_string(static_cast<long long>(wallet->GetBalance())));
 }
 
 bool AppController::DeleteTransaction(const std::string& transactionId) {
     std::lock_guard<std::recursive_mutex> lock(dataMutex);
-    int foundIndex = -1;
-    Transaction* target = nullptr;
+    EntityId key = EntityId::FromString(transactionId);
+    Transaction** found = transactionsMap->Get(key);
 
-    for (size_t i = 0; i < transactions->Count(); ++i) {
-        if (transactions->Get(i)->GetId() == transactionId) {
-            foundIndex = (int)i;
-            target = transactions->Get(i);
-            break;
-        }
-    }
-
-    if (foundIndex == -1 || target == nullptr) {
+    if (found == nullptr) {
         if (view) view->ShowError("Transaction ID not found: " + transactionId);
         return false;
     }
+    Transaction* target = *found;
 
     Wallet* w = GetWalletById(target->GetWalletId());
     if (w != nullptr) {
@@ -371,10 +608,15 @@ bool AppController::DeleteTransaction(const std::string& transactionId) {
         if (view) view->ShowWarning("Linked Wallet not found. Balance not restored.");
     }
 
+    // Every container is keyed by ledger order or ID: O(log N) end to end
+    ++dataGeneration;
     RemoveTransactionFromIndex(target); 
-    transactions->RemoveAt(foundIndex);
-    transactionsMap->Remove(transactionId);
-    delete target;
+    transactions->Remove(target);
+    amountIndex->Remove(target);
+    transactionsMap->Remove(key);
+    target->ReleaseDescription(*descriptions);
+    transactionStore->Free(target);
+    CompactSlots();
     return true;
 }
 
@@ -401,13 +643,16 @@ void AppController::AddRecurringTransaction(Frequency freq, Date startDate, Date
 
     std::string prefix = EnumHelper::IdPrefixToString(IdPrefix::Recurring);
     std::string id;
+    EntityId key;
     do {
         id = IdGenerator::GenerateId(prefix);
-    } while (recurringTransactionsMap->ContainsKey(id));
+        key = EntityId::FromString(id);
+    } while (recurringTransactionsMap->ContainsKey(key));
     
     RecurringTransaction* rt = new RecurringTransaction(id, freq, startDate, endDate, walletId, categoryId, amount, type, desc);
     recurringTransactions->Add(rt);
-    recurringTransactionsMap->Put(id, rt);
+    recurringTransactionsMap->Put(key, rt);
+    TrackRecurringUsage(rt, +1);
     
     ProcessRecurringTransactions();
     if (view) view->ShowSuccess("Recurring transaction scheduled.");
@@ -415,7 +660,7 @@ void AppController::AddRecurringTransaction(Frequency freq, Date startDate, Date
 
 RecurringTransaction* AppController::GetRecurringById(const std::string& id) {
     std::lock_guard<std::recursive_mutex> lock(dataMutex);
-    RecurringTransaction** r = recurringTransactionsMap->Get(id);
+    RecurringTransaction** r = recurringTransactionsMap->Get(EntityId::FromString(id));
     return (r != nullptr) ? *r : nullptr;
 }
 
@@ -438,7 +683,8 @@ bool AppController::DeleteRecurringTransaction(const std::string& id) {
         recurringTransactions->RemoveAt(foundIndex);
     }
 
-    recurringTransactionsMap->Remove(id);
+    recurringTransactionsMap->Remove(EntityId::FromString(id));
+    TrackRecurringUsage(r, -1);
     delete r;
 
     if (view) view->ShowSuccess("Recurring transaction deleted: " + id);
@@ -468,6 +714,7 @@ void AppController::EditRecurringTransaction(const std::string& id, Frequency fr
         return;
     }
 
+    TrackRecurringUsage(r, -1);
     r->SetFrequency(freq);
     r->SetStartDate(startDate);
     r->SetEndDate(endDate);
@@ -475,6 +722,7 @@ void AppController::EditRecurringTransaction(const std::string& id, Frequency fr
     r->SetCategoryId(categoryId);
     r->SetAmount(amount);
     r->SetDescription(desc);
+    TrackRecurringUsage(r, +1);
     
     ProcessRecurringTransactions();
 
@@ -499,15 +747,19 @@ void AppController::ProcessRecurringTransactions() {
             
             std::string prefix = EnumHelper::IdPrefixToString(IdPrefix::Transaction);
             std::string newTransId;
+            EntityId newTransKey;
             do {
                 newTransId = IdGenerator::GenerateId(prefix);
-            } while (transactionsMap->ContainsKey(newTransId));
+                newTransKey = EntityId::FromString(newTransId);
+            } while (transactionsMap->ContainsKey(newTransKey));
             
-            Transaction* autoTrans = rt->GenerateTransaction(newTransId, dueDate); 
+            Transaction* autoTrans = transactionStore->Allocate(rt->GenerateTransaction(*descriptions, newTransId, dueDate));
             
-            size_t pos = GetSortedInsertIndex(transactions, autoTrans->GetDate());
-            transactions->Insert(pos, autoTrans);
-            transactionsMap->Put(newTransId, autoTrans);
+            ++dataGeneration;
+            autoTrans->SetSequence(nextSequence++);
+            transactions->Insert(autoTrans);
+            amountIndex->Insert(autoTrans);
+            transactionsMap->Put(newTransKey, autoTrans);
             AddTransactionToIndex(autoTrans);
             
             if (rt->GetType() == TransactionType::Income) {
@@ -529,40 +781,7 @@ void AppController::ProcessRecurringTransactions() {
 
 // --- Binary Search for Date Range ---
 ArrayList<Transaction*>* AppController::GetTransactionsByDateRange(Date start, Date end) {
-    std::lock_guard<std::recursive_mutex> lock(dataMutex);
-    ArrayList<Transaction*>* result = new ArrayList<Transaction*>();
-
-    if (transactions->Count() == 0) return result;
-
-    int low = 0;
-    int high = static_cast<int>(transactions->Count()) - 1;
-    int startIndex = -1;
-
-    while (low <= high) {
-        int mid = low + (high - low) / 2;
-        Transaction* midItem = transactions->Get(mid);
-
-        if (midItem->GetDate() >= start) {
-            startIndex = mid;   
-            high = mid - 1;
-        } else {
-            low = mid + 1;      
-        }
-    }
-
-    if (startIndex != -1) {
-        for (size_t i = static_cast<size_t>(startIndex); i < transactions->Count(); ++i) {
-            Transaction* t = transactions->Get(i);
-            
-            if (t->GetDate() > end) {
-                break; 
-            }
-            
-            result->Add(t);
-        }
-    }
-
-    return result;
+    return RunQuery(TransactionQuery().InDateRange(start, end));
 }
 
 // =================================================================================
@@ -593,22 +812,15 @@ void AppController::EditWallet(const std::string& id, const std::string& newName
 bool AppController::DeleteWallet(const std::string& id) {
     std::lock_guard<std::recursive_mutex> lock(dataMutex);
 
-    for (size_t i = 0; i < transactions->Count(); ++i) {
-        if (transactions->Get(i)->GetWalletId() == id) {
-            return false; 
-        }
-    }
-    
-    for (size_t i = 0; i < recurringTransactions->Count(); ++i) {
-        if (recurringTransactions->Get(i)->GetWalletId() == id) {
-            return false; 
-        }
-    }
+    // Restrict delete: still referenced by transactions or recurring templates
+    if (GetUsage(id).Total() > 0) return false;
 
-    if (walletsMap->ContainsKey(id)) {
-        Wallet* w = *walletsMap->Get(id);
+    EntityId key = EntityId::FromString(id);
+    if (walletsMap->ContainsKey(key)) {
+        Wallet* w = *walletsMap->Get(key);
         walletsList->Remove(w);
-        walletsMap->Remove(id);
+        walletsMap->Remove(key);
+        usageCounts->Remove(key);
         delete w;
         return true;
     }
@@ -622,25 +834,14 @@ bool AppController::DeleteWallet(const std::string& id) {
 bool AppController::DeleteCategory(const std::string& id) {
     std::lock_guard<std::recursive_mutex> lock(dataMutex);
     
-    for (size_t i = 0; i < transactions->Count(); ++i) {
-        Transaction* t = transactions->Get(i);
-
-        if (t->GetType() == TransactionType::Expense && t->GetCategoryId() == id) {
-            return false; 
-        }
-    }
-    
-    for (size_t i = 0; i < recurringTransactions->Count(); ++i) {
-        RecurringTransaction* rt = recurringTransactions->Get(i);
-        if (rt->GetType() == TransactionType::Expense && rt->GetCategoryId() == id) {
-            return false; 
-        }
-    }
+    if (GetUsage(id).Total() > 0) return false;
 
-    if (categoriesMap->ContainsKey(id)) {
-        Category* c = *categoriesMap->Get(id);
+    EntityId key = EntityId::FromString(id);
+    if (categoriesMap->ContainsKey(key)) {
+        Category* c = *categoriesMap->Get(key);
         categoriesList->Remove(c); 
-        categoriesMap->Remove(id); 
+        categoriesMap->Remove(key); 
+        usageCounts->Remove(key);
         delete c; 
         return true;
     }
@@ -669,25 +870,14 @@ void AppController::EditIncomeSource(const std::string& id, const std::string& n
 bool AppController::DeleteIncomeSource(const std::string& id) {
     std::lock_guard<std::recursive_mutex> lock(dataMutex);
     
-    for (size_t i = 0; i < transactions->Count(); ++i) {
-        Transaction* t = transactions->Get(i);
-
-        if (t->GetType() == TransactionType::Income && t->GetCategoryId() == id) {
-            return false; 
-        }
-    }
-    
-    for (size_t i = 0; i < recurringTransactions->Count(); ++i) {
-        RecurringTransaction* rt = recurringTransactions->Get(i);
-        if (rt->GetType() == TransactionType::Income && rt->GetCategoryId() == id) {
-            return false; 
-        }
-    }
+    if (GetUsage(id).Total() > 0) return false;
 
-    if (incomeSourcesMap->ContainsKey(id)) {
-        IncomeSource* s = *incomeSourcesMap->Get(id);
+    EntityId key = EntityId::FromString(id);
+    if (incomeSourcesMap->ContainsKey(key)) {
+        IncomeSource* s = *incomeSourcesMap->Get(key);
         incomeSourcesList->Remove(s);
-        incomeSourcesMap->Remove(id);
+        incomeSourcesMap->Remove(key);
+        usageCounts->Remove(key);
         delete s;
         return true;
     }
@@ -705,7 +895,7 @@ bool AppController::EditTransaction(const std::string& id, double newAmount, Dat
         return false;
     }
 
-    Transaction** tPtr = transactionsMap->Get(id);
+    Transaction** tPtr = transactionsMap->Get(EntityId::FromString(id));
     if (tPtr == nullptr) {
         if (view) view->ShowError("Transaction ID not found: " + id);
         return false;
@@ -719,11 +909,24 @@ bool AppController::EditTransaction(const std::string& id, double newAmount, Dat
     }
     
     bool dateChanged = (target->GetDate()) != newDate;
+    bool amountChanged = target->GetAmount() != newAmount;
+    bool descChanged = target->GetDescription(*descriptions) != newDesc;
     
+    // Unlink under the old key before the date, amount or description changes
     if (dateChanged) {
+        ++dataGeneration;
         RemoveTransactionFromIndex(target);
         transactions->Remove(target);
     }
+    else if (descChanged) {
+        VacateSlot(target);
+    }
+    if (dateChanged || amountChanged) {
+        amountIndex->Remove(target);
+    }
+    if (!dateChanged && amountChanged) {
+        TrackTotals(target, -1);
+    }
 
     if (target->GetType() == TransactionType::Income) {
         w->SubtractAmount(target->GetAmount()); 
@@ -739,13 +942,24 @@ bool AppController::EditTransaction(const std::string& id, double newAmount, Dat
 
     target->SetAmount(newAmount);
     target->SetDate(newDate);
-    target->SetDescription(newDesc);
+    target->SetDescription(*descriptions, newDesc);
     
     if (dateChanged) {
-        size_t newPos = GetSortedInsertIndex(transactions, newDate);
-        transactions->Insert(newPos, target);
+        target->SetSequence(nextSequence++);
+        transactions->Insert(target);
         AddTransactionToIndex(target);
     }
+    else if (descChanged) {
+        AssignSlot(target);
+    }
+    if (dateChanged || amountChanged) {
+        amountIndex->Insert(target);
+    }
+    if (!dateChanged && amountChanged) {
+        TrackTotals(target, +1);
+    }
+    (*slotAmounts)[target->GetSlot()] = newAmount;
+    CompactSlots();
 
     if (view) view->ShowSuccess("Transaction updated. Wallet balance adjusted.");
     return true;
@@ -756,76 +970,793 @@ bool AppController::EditTransaction(const std::string& id, double newAmount, Dat
 // =================================================================================
 
 ArrayList<Transaction*>* AppController::GetTransactionsByType(TransactionType type) {
+    return RunQuery(TransactionQuery().OfType(type));
+}
+
+ArrayList<Transaction*>* AppController::GetTransactionsByAmountRange(double minAmount, double maxAmount) {
+    return RunQuery(TransactionQuery().InAmountRange(minAmount, maxAmount));
+}
+
+TransactionView AppController::GetTransactionsByWallet(const std::string& walletId) {
     std::lock_guard<std::recursive_mutex> lock(dataMutex);
     
-    return Filter(transactions, [type](Transaction* t) {
-        return t->GetType() == type;
-    });
+    TransactionLedger** cached = walletIndex->Get(EntityId::FromString(walletId));
+    return TransactionView((cached != nullptr) ? *cached : nullptr, &dataGeneration);
 }
 
-ArrayList<Transaction*>* AppController::GetTransactionsByAmountRange(double minAmount, double maxAmount) {
+TransactionView AppController::GetTransactionsByCategory(const std::string& categoryId) {
     std::lock_guard<std::recursive_mutex> lock(dataMutex);
     
-    return AppHelpers::Filter(transactions, [minAmount, maxAmount](Transaction* t) {
-        return t->GetAmount() >= minAmount && t->GetAmount() <= maxAmount;
-    });
+    TransactionLedger** cached = categoryIndex->Get(EntityId::FromString(categoryId));
+    return TransactionView((cached != nullptr) ? *cached : nullptr, &dataGeneration);
 }
 
-ArrayList<Transaction*>* AppController::GetTransactionsByWallet(const std::string& walletId) {
+TransactionView AppController::GetTransactionsByIncomeSource(const std::string& sourceId) {
     std::lock_guard<std::recursive_mutex> lock(dataMutex);
     
-    ArrayList<Transaction*>* result = new ArrayList<Transaction*>();
+    TransactionLedger** cached = incomeSourceIndex->Get(EntityId::FromString(sourceId));
+    return TransactionView((cached != nullptr) ? *cached : nullptr, &dataGeneration);
+}
 
-    if (walletIndex->ContainsKey(walletId)) {
-        ArrayList<Transaction*>* cachedList = *walletIndex->Get(walletId);
-        
-        for (size_t i = 0; i < cachedList->Count(); ++i) {
-            result->Add(cachedList->Get(i));
-        }
+ArrayList<Transaction*>* AppController::SearchTransactions(const std::string& keyword, bool ignoreCase) {
+    std::lock_guard<std::recursive_mutex> lock(dataMutex);
+
+    TransactionQuery query = TransactionQuery().Containing(keyword, ignoreCase);
+    ArrayList<Transaction*>* result = RunQuery(query);
+
+    // The transaction whose ID is the keyword joins the matches (a hash lookup), in ledger order
+    Transaction** byId = transactionsMap->Get(EntityId::FromString(keyword));
+    if (byId != nullptr && !query.Matches(*byId, *descriptions)) {
+        Transaction** position = std::upper_bound(result->begin(), result->end(), *byId, TransactionOrder());
+        result->Insert(static_cast<size_t>(position - result->begin()), *byId);
     }
-    
     return result;
 }
 
-ArrayList<Transaction*>* AppController::GetTransactionsByCategory(const std::string& categoryId) {
+ArrayList<Transaction*>* AppController::SearchTransactionsFuzzy(const std::string& text, int maxEdits) {
+    return RunQuery(TransactionQuery().Resembling(text, maxEdits));
+}
+
+// ---------------------------------------------------------
+// 8.1. QUERY ENGINE
+// ---------------------------------------------------------
+
+static bool DateBefore(Transaction* t, const Date& d) { return t->GetDate() < d; }
+static bool DateNotAfter(Transaction* t, const Date& d) { return !(t->GetDate() > d); }
+static bool AmountBelow(Transaction* t, double amount) { return t->GetAmount() < amount; }
+static bool AmountNotAbove(Transaction* t, double amount) { return !(t->GetAmount() > amount); }
+
+// Result orders (ties always fall back to ledger order, so results are deterministic)
+static bool LedgerBefore(Transaction* a, Transaction* b) { return TransactionOrder()(a, b); }
+static bool LedgerAfter(Transaction* a, Transaction* b) { return TransactionOrder()(b, a); }
+static bool AmountLess(Transaction* a, Transaction* b) { return TransactionAmountOrder()(a, b); }
+static bool AmountGreater(Transaction* a, Transaction* b) { return TransactionAmountOrder()(b, a); }
+
+/// Date slice [first, last) of a ledger-ordered list, or the whole list.
+static void DateSlice(const TransactionLedger* list, const TransactionQuery& query,
+                      TransactionLedger::Iterator& first, TransactionLedger::Iterator& last) {
+    first = query.HasDateRange() ? list->LowerBound(query.GetStartDate(), DateBefore) : list->begin();
+    last = query.HasDateRange() ? list->LowerBound(query.GetEndDate(), DateNotAfter) : list->end();
+}
+
+/// Rows of a ledger-ordered list the query would visit: the date slice, or the whole list.
+static size_t CandidateRows(const TransactionLedger* list, const TransactionQuery& query) {
+    if (!query.HasDateRange()) return list->Count();
+
+    size_t first = list->Rank(query.GetStartDate(), DateBefore);
+    size_t last = list->Rank(query.GetEndDate(), DateNotAfter);
+    return (last > first) ? last - first : 0;
+}
+
+/// Rows of the amount index the query would visit: the amount slice, or every row.
+static size_t CandidateRows(const TransactionAmountIndex* index, const TransactionQuery& query) {
+    if (!query.HasAmountRange()) return index->Count();
+
+    size_t first = index->Rank(query.GetMinAmount(), AmountBelow);
+    size_t last = index->Rank(query.GetMaxAmount(), AmountNotAbove);
+    return (last > first) ? last - first : 0;
+}
+
+/// Feeds [first, last) to 'visit' in either direction until it returns false.
+template <typename Iterator, typename Visit>
+static void WalkSlice(Iterator first, Iterator last, bool backward, Visit visit) {
+    if (backward) {
+        while (last != first) {
+            --last;
+            if (!visit(*last)) return;
+        }
+    }
+    else {
+        for (; first != last; ++first) {
+            if (!visit(*first)) return;
+        }
+    }
+}
+
+/// Group of a transaction under 'key'.
+static GroupValue GroupOf(const Transaction* t, GroupKey key) {
+    GroupValue value;
+    switch (key) {
+        case GroupKey::Type:     value.number = static_cast<int>(t->GetType()); break;
+        case GroupKey::Wallet:   value.id = t->GetWalletKey(); break;
+        case GroupKey::Category: value.id = t->GetCategoryKey(); break;
+        case GroupKey::Month:    value.number = MonthKey(t->GetDate()); break;
+    }
+    return value;
+}
+
+/// Whether a rollup cell meets the query's type / wallet / category conditions; sets its group under 'key'.
+static bool CellGroup(const TransactionQuery& query, GroupKey key, int month, const RollupKey& cell, GroupValue& value) {
+    if (query.HasType() && cell.type != static_cast<int>(query.GetType())) return false;
+    if (query.HasWallet() && cell.wallet != query.GetWalletKey()) return false;
+    if (query.HasCategory() && cell.category != query.GetCategoryKey()) return false;
+
+    switch (key) {
+        case GroupKey::Type:     value.number = cell.type; break;
+        case GroupKey::Wallet:   value.id = cell.wallet; break;
+        case GroupKey::Category: value.id = cell.category; break;
+        case GroupKey::Month:    value.number = month; break;
+    }
+    return true;
+}
+
+/// Adds one partial group table into another.
+static void MergeGroups(const TransactionGroups& partial, bool extremes, TransactionGroups& groups) {
+    partial.ForEach([&](const GroupValue& value, const GroupTotals& totals) {
+        if (extremes) groups[value].Merge(totals.count, totals.sum, totals.min, totals.max);
+        else groups[value].Merge(totals.count, totals.sum);
+    });
+}
+
+/**
+ * Relative cost of walking 'rows' rows. A walk that is not in result order
+ * must also sort what it keeps; that sort chases pointers and measured about
+ * 2 x log2(rows) times slower per row than a plain scan. A limit caps the
+ * kept rows, so limited walks cost the scan alone, and one in result order
+ * stops after about limit / matchShare rows ('matchShare': expected share of
+ * walked rows that match).
+ */
+static double PlanCost(size_t rows, bool ordered, size_t limit, double matchShare) {
+    if (ordered && limit > 0) return std::min((double)rows, limit / matchShare);
+    if (ordered || limit > 0 || rows < 2) return (double)rows;
+    return rows * (1.0 + 2.0 * std::log2((double)rows));
+}
+
+const TransactionLedger* AppController::ResolvePlan(const TransactionQuery& query, QueryPlan& plan) {
+    plan = QueryPlan();
+    planRowsExact = false;
+    plan.totalRows = transactions->Count();
+
+    bool byAmount = query.GetSort() == QuerySort::AmountAscending || query.GetSort() == QuerySort::AmountDescending;
+    const TransactionLedger* best = nullptr;
+    double bestCost = 0;
+    bool chosen = false;
+
+    // Description text: the trigram index bounds the candidates, and so the
+    // share of rows that can match (what a limited walk in result order reads)
+    struct TextSearch { bool present; const std::string* text; int edits; bool fuzzy; size_t rows; };
+    TextSearch texts[2] = {
+        { query.HasKeyword(), &query.GetKeyword(), 0, false, 0 },
+        { query.HasFuzzyText(), &query.GetFuzzyText(), query.GetMaxEdits(), true, 0 }
+    };
+
+    double matchShare = 1.0;
+    for (TextSearch& search : texts) {
+        if (search.present) {
+            search.present = textIndex->EstimateCandidates(search.text->data(), search.text->size(), search.edits, search.rows);
+        }
+        if (!search.present) continue;
+
+        if (search.rows == 0) {
+            // The trigram lists prove no description can match
+            plan = QueryPlan();
+            plan.totalRows = transactions->Count();
+            return nullptr;
+        }
+        if (plan.totalRows > 0) matchShare = std::min(matchShare, (double)search.rows / plan.totalRows);
+    }
+
+    // Keeps the cheapest path; on equal cost the one already in result order wins
+    auto consider = [&](QueryPlan::Path path, const TransactionLedger* list, size_t rows, bool ordered) {
+        double cost = PlanCost(rows, ordered, query.GetLimit(), matchShare);
+        if (chosen && !(cost < bestCost || (cost == bestCost && ordered && !plan.ordered))) return false;
+
+        chosen = true;
+        best = list;
+        bestCost = cost;
+        plan.path = path;
+        plan.candidateRows = rows;
+        plan.ordered = ordered;
+        plan.fuzzy = false;
+        plan.exact = false;
+        return true;
+    };
+
+    // Ledger-ordered candidates: the ledger, plus every index named by a condition
+    consider(QueryPlan::Path::Ledger, transactions, CandidateRows(transactions, query), !byAmount);
+
+    struct Candidate { HashMap<EntityId, TransactionLedger*>* index; const EntityId* key; QueryPlan::Path path; };
+    Candidate candidates[2];
+    size_t candidateCount = 0;
+
+    if (query.HasWallet())
+        candidates[candidateCount++] = { walletIndex, &query.GetWalletKey(), QueryPlan::Path::WalletIndex };
+
+    if (query.HasCategory()) {
+        bool income = query.HasType() && query.GetType() == TransactionType::Income;
+        candidates[candidateCount++] = income
+            ? Candidate{ incomeSourceIndex, &query.GetCategoryKey(), QueryPlan::Path::SourceIndex }
+            : Candidate{ categoryIndex, &query.GetCategoryKey(), QueryPlan::Path::CategoryIndex };
+    }
+
+    for (size_t i = 0; i < candidateCount; ++i) {
+        TransactionLedger** list = candidates[i].index->Get(*candidates[i].key);
+        if (list == nullptr) {
+            // Nothing carries this key, so nothing can match
+            plan = QueryPlan();
+            plan.totalRows = transactions->Count();
+            return nullptr;
+        }
+        consider(candidates[i].path, *list, CandidateRows(*list, query), !byAmount);
+    }
+
+    // The trigram candidates (in slot order, so never ordered)
+    for (const TextSearch& search : texts) {
+        if (search.present && consider(QueryPlan::Path::TrigramIndex, nullptr, search.rows, false)) plan.fuzzy = search.fuzzy;
+    }
+
+    // The amount index, sliced by the amount range and already in amount order
+    if (query.HasAmountRange() || byAmount) {
+        consider(QueryPlan::Path::AmountIndex, nullptr, CandidateRows(amountIndex, query), byAmount);
+    }
+
+    // Column bitmaps: two or more type / wallet / category / month conditions, intersected
+    // (slot order is not result order)
+    bool exact = false;
+    if (plan.candidateRows >= BITMAP_MIN_ROWS && SelectRows(query, *planRows, exact, 2)) {
+        planRowsExact = exact;
+        if (planRows->IsEmpty()) {
+            plan = QueryPlan();
+            plan.totalRows = transactions->Count();
+            return nullptr;
+        }
+        if (consider(QueryPlan::Path::Bitmap, nullptr, planRows->Count(), false)) plan.exact = exact;
+    }
+
+    if (plan.path == QueryPlan::Path::AmountIndex) {
+        plan.amountSeek = query.HasAmountRange();
+        plan.backward = query.GetSort() == QuerySort::AmountDescending;
+    }
+    else if (plan.path == QueryPlan::Path::Ledger || plan.path == QueryPlan::Path::WalletIndex ||
+             plan.path == QueryPlan::Path::CategoryIndex || plan.path == QueryPlan::Path::SourceIndex) {
+        plan.dateSeek = query.HasDateRange();
+        plan.backward = query.GetSort() == QuerySort::DateDescending;
+    }
+    return best;
+}
+
+/**
+ * Intersects the column bitmaps named by the query's type, wallet, category
+ * and date conditions (the date range as the union of the months it touches,
+ * if it spans at most BITMAP_MAX_MONTHS). Returns false when fewer than
+ * 'minColumns' columns apply. 'exact' tells whether the rows are exactly the
+ * matches, i.e. no other condition applies and the range covers whole months.
+ */
+bool AppController::SelectRows(const TransactionQuery& query, RoaringBitmap& rows, bool& exact, size_t minColumns) {
+    const RoaringBitmap* columns[4];
+    size_t columnCount = 0;
+    bool absent = false; // A value no row has ever held
+
+    auto use = [&](const RoaringBitmap* column) {
+        if (column == nullptr) absent = true;
+        else columns[columnCount] = column;
+        ++columnCount;
+    };
+
+    if (query.HasType()) use(typeRows->Get(static_cast<int>(query.GetType())));
+    if (query.HasWallet()) use(walletRows->Get(query.GetWalletKey()));
+    if (query.HasCategory()) use(categoryRows->Get(query.GetCategoryKey()));
+
+    RoaringBitmap months;
+    bool wholeMonths = !query.HasDateRange();
+    if (query.HasDateRange()) {
+        const Date& start = query.GetStartDate();
+        const Date& end = query.GetEndDate();
+        int first = MonthKey(start), last = MonthKey(end);
+
+        if (first <= last && last - first < BITMAP_MAX_MONTHS) {
+            for (int month = first; month <= last; ++month) {
+                const RoaringBitmap* column = monthRows->Get(month);
+                if (column != nullptr) months.Or(*column);
+            }
+            use(&months);
+            wholeMonths = start.GetDay() == 1 && end == Date::GetEndOfMonth(end.GetMonth(), end.GetYear());
+        }
+    }
+
+    if (columnCount < minColumns) return false;
+    exact = wholeMonths && !query.HasAmountRange() && !query.HasKeyword() && !query.HasFuzzyText();
+
+    rows.Clear();
+    if (absent) return true;
+
+    // Smallest first: every AND result is at most that size (at most 4 columns, so an insertion sort)
+    for (size_t i = 1; i < columnCount; ++i) {
+        const RoaringBitmap* column = columns[i];
+        size_t j = i;
+        for (; j > 0 && column->Count() < columns[j - 1]->Count(); --j) columns[j] = columns[j - 1];
+        columns[j] = column;
+    }
+    rows.Assign(*columns[0]);
+    for (size_t i = 1; i < columnCount && !rows.IsEmpty(); ++i) {
+        rows.And(*columns[i]);
+    }
+    return true;
+}
+
+/// Feeds the candidate rows of a resolved plan to 'visit' until it returns false.
+template <typename Visit>
+void AppController::WalkPlan(const TransactionQuery& query, const QueryPlan& plan, const TransactionLedger* source, Visit visit) {
+    if (plan.path == QueryPlan::Path::AmountIndex) {
+        TransactionAmountIndex::Iterator first = plan.amountSeek ? amountIndex->LowerBound(query.GetMinAmount(), AmountBelow) : amountIndex->begin();
+        TransactionAmountIndex::Iterator last = plan.amountSeek ? amountIndex->LowerBound(query.GetMaxAmount(), AmountNotAbove) : amountIndex->end();
+        WalkSlice(first, last, plan.backward, visit);
+    }
+    else if (plan.path == QueryPlan::Path::TrigramIndex) {
+        const std::string& text = plan.fuzzy ? query.GetFuzzyText() : query.GetKeyword();
+        ArrayList<uint32_t> candidates;
+        textIndex->Candidates(text.data(), text.size(), plan.fuzzy ? query.GetMaxEdits() : 0, candidates);
+        for (size_t i = 0; i < candidates.Count(); ++i) {
+            Transaction* t = (*slots)[candidates[i]];
+            if (t != nullptr && !visit(t)) break;
+        }
+    }
+    else if (plan.path == QueryPlan::Path::Bitmap) {
+        // Bitmaps only hold live slots
+        planRows->ForEach([&](uint32_t slot) { return visit((*slots)[slot]); });
+    }
+    else {
+        TransactionLedger::Iterator first = source->begin(), last = source->end();
+        DateSlice(source, query, first, last);
+        WalkSlice(first, last, plan.backward, visit);
+    }
+}
+
+QueryPlan AppController::PlanQuery(const TransactionQuery& query) {
     std::lock_guard<std::recursive_mutex> lock(dataMutex);
 
+    QueryPlan plan;
+    ResolvePlan(query, plan);
+    return plan;
+}
+
+ArrayList<Transaction*>* AppController::RunQuery(const TransactionQuery& query) {
+    std::lock_guard<std::recursive_mutex> lock(dataMutex);
     ArrayList<Transaction*>* result = new ArrayList<Transaction*>();
 
-    if (categoryIndex->ContainsKey(categoryId)) {
-        ArrayList<Transaction*>* cachedList = *categoryIndex->Get(categoryId);
-        
-        for (size_t i = 0; i < cachedList->Count(); ++i) {
-            result->Add(cachedList->Get(i));
+    QueryPlan plan;
+    const TransactionLedger* source = ResolvePlan(query, plan);
+    if (plan.path == QueryPlan::Path::Empty || plan.candidateRows == 0) return result;
+
+    bool (*order)(Transaction*, Transaction*) = LedgerBefore;
+    switch (query.GetSort()) {
+        case QuerySort::DateAscending:    order = LedgerBefore; break;
+        case QuerySort::DateDescending:   order = LedgerAfter; break;
+        case QuerySort::AmountAscending:  order = AmountLess; break;
+        case QuerySort::AmountDescending: order = AmountGreater; break;
+    }
+
+    // An ordered walk is already in result order, so a limit stops it early.
+    // Otherwise a limit keeps at most 2 x limit rows: when the buffer fills,
+    // nth_element keeps the best 'limit' and the worst of those becomes a
+    // cutoff that later rows must beat before they are even matched.
+    size_t limit = query.GetLimit();
+    Transaction* cutoff = nullptr;
+
+    // A keyword the trigram index could not narrow (under 3 bytes, or another
+    // path won) would be searched row by row. When the walk is large, one
+    // vectorized pass over the arena marks every match instead, and a row
+    // then only checks whether a mark falls inside its description (a mark
+    // there proves the keyword, so Matches() skips it).
+    // A single case-sensitive byte is already a memchr per row, and an ordered
+    // walk with a limit may stop early, so both keep the row test.
+    const std::string& keyword = query.GetKeyword();
+    bool arenaScan = query.HasKeyword() && plan.path != QueryPlan::Path::TrigramIndex && !(plan.ordered && limit > 0) &&
+                     (keyword.size() >= 2 || (keyword.size() == 1 && query.KeywordIgnoresCase())) &&
+                     plan.candidateRows * ARENA_SCAN_MIN_SHARE >= transactions->Count();
+
+    uint64_t* marks = nullptr;
+    if (arenaScan) {
+        const StringArena& arena = *descriptions;
+        size_t words = TextScan::MarkWords(arena.Size());
+        marks = new uint64_t[words]();
+        if (TextScan::MarkAll(arena.Buffer(), arena.Size(), keyword.data(), keyword.size(), query.KeywordIgnoresCase(), marks) == 0) {
+            delete[] marks;
+            return result;
         }
     }
 
+    auto visit = [&](Transaction* t) {
+        if (cutoff != nullptr && !order(t, cutoff)) return true;
+        if (marks != nullptr) {
+            StringRef ref = t->GetDescriptionRef();
+            if (ref.length < keyword.size() || !TextScan::AnyMarked(marks, ref.offset, ref.offset + ref.length - keyword.size())) return true;
+        }
+        if (!query.Matches(t, *descriptions, marks != nullptr)) return true;
+
+        result->Add(t);
+        if (limit == 0) return true;
+        if (plan.ordered) return result->Count() < limit;
+
+        if (result->Count() == 2 * limit) {
+            std::nth_element(result->begin(), result->begin() + (limit - 1), result->end(), order);
+            while (result->Count() > limit) result->RemoveAt(result->Count() - 1);
+            cutoff = (*result)[limit - 1];
+        }
+        return true;
+    };
+
+    WalkPlan(query, plan, source, visit);
+    delete[] marks;
+
+    size_t keep = (limit > 0 && limit < result->Count()) ? limit : result->Count();
+    if (!plan.ordered) {
+        std::partial_sort(result->begin(), result->begin() + keep, result->end(), order);
+    }
+    while (result->Count() > keep) result->RemoveAt(result->Count() - 1);
+
     return result;
 }
 
-ArrayList<Transaction*>* AppController::GetTransactionsByIncomeSource(const std::string& sourceId) {
+QueryTotals AppController::Aggregate(const TransactionQuery& query) {
     std::lock_guard<std::recursive_mutex> lock(dataMutex);
-    
-    ArrayList<Transaction*>* result = new ArrayList<Transaction*>();
+    QueryTotals totals;
+
+    // Any date range from the daily sums; else whole months from the rollup and edge months from the records
+    TransactionGroups byType;
+    if (query.GetLimit() == 0 && (CollectDailyGroups(query, byType) || CollectRollupGroups(query, GroupKey::Type, byType))) {
+        byType.ForEach([&](const GroupValue&, const GroupTotals& group) {
+            totals.count += group.count;
+            totals.amount += group.sum;
+        });
+        return totals;
+    }
 
-    if (incomeSourceIndex->ContainsKey(sourceId)) {
-        ArrayList<Transaction*>* cachedList = *incomeSourceIndex->Get(sourceId);
-        
-        for (size_t i = 0; i < cachedList->Count(); ++i) {
-            result->Add(cachedList->Get(i));
+    QueryPlan plan;
+    ResolvePlan(query, plan);
+    if (plan.path == QueryPlan::Path::Empty) return totals;
+
+    // Conditions the bitmaps cover exactly (even a single column) need no
+    // walk at all, unless the walk is short enough to beat building them.
+    // Planning may already have built them.
+    bool exact = false;
+    if (!planRowsExact && plan.candidateRows >= BITMAP_MIN_ROWS && SelectRows(query, *planRows, exact, 1)) {
+        planRowsExact = exact;
+    }
+
+    // Exact bitmap answer: the count is known, the sum reads the amount column in slot order
+    if (planRowsExact && query.GetLimit() == 0) {
+        const double* amounts = slotAmounts->begin();
+        totals.count = planRows->Count();
+        planRows->ForEach([&](uint32_t slot) {
+            totals.amount += amounts[slot];
+            return true;
+        });
+        return totals;
+    }
+
+    ArrayList<Transaction*>* matches = RunQuery(query);
+    totals.count = matches->Count();
+    for (Transaction* t : *matches) {
+        totals.amount += t->GetAmount();
+    }
+    delete matches;
+    return totals;
+}
+
+/// Adds the query's matches to 'groups' from the bitmaps or one walk (no rollup).
+void AppController::CollectGroups(const TransactionQuery& query, GroupKey key, bool extremes, TransactionGroups& groups) {
+    QueryPlan plan;
+    const TransactionLedger* source = ResolvePlan(query, plan);
+    if (plan.path == QueryPlan::Path::Empty || plan.candidateRows == 0) return;
+
+    // Type and month groups are few and each has a column bitmap: when the
+    // bitmaps answer the query exactly, a group is the intersection with its
+    // value's bitmap, totalled from the amount column without reading records
+    int firstValue = 0, lastValue = -1;
+    BitmapIndex<int>* column = nullptr;
+    if (key == GroupKey::Type) {
+        column = typeRows;
+        firstValue = static_cast<int>(TransactionType::Income);
+        lastValue = static_cast<int>(TransactionType::Expense);
+    }
+    else if (key == GroupKey::Month && query.HasDateRange()) {
+        column = monthRows;
+        firstValue = MonthKey(query.GetStartDate());
+        lastValue = MonthKey(query.GetEndDate());
+    }
+
+    bool exact = false;
+    if (column != nullptr && !planRowsExact && plan.candidateRows >= BITMAP_MIN_ROWS && SelectRows(query, *planRows, exact, 1)) {
+        planRowsExact = exact;
+    }
+
+    if (planRowsExact && column != nullptr && lastValue - firstValue < BITMAP_MAX_MONTHS) {
+        const double* amounts = slotAmounts->begin();
+        RoaringBitmap rows;
+        for (int value = firstValue; value <= lastValue; ++value) {
+            const RoaringBitmap* valueRows = column->Get(value);
+            if (valueRows == nullptr) continue;
+
+            rows.Assign(*planRows);
+            rows.And(*valueRows);
+            if (rows.IsEmpty()) continue;
+
+            GroupTotals& totals = groups[GroupValue::Of(value)];
+            rows.ForEach([&](uint32_t slot) {
+                if (extremes) totals.Add(amounts[slot]);
+                else totals.Merge(1, amounts[slot]);
+                return true;
+            });
         }
+        return;
     }
-    
-    return result;
+
+    // Otherwise one walk of the planned slice (usually the date-seeked
+    // ledger); each match costs one probe of the flat group table
+    WalkPlan(query, plan, source, [&](Transaction* t) {
+        if (!plan.exact && !query.Matches(t, *descriptions)) return true;
+
+        GroupValue value = GroupOf(t, key);
+        if (extremes) groups[value].Add(t->GetAmount());
+        else groups[value].Merge(1, t->GetAmount());
+        return true;
+    });
+}
+
+/**
+ * Adds the query's matches to 'groups' from the monthly rollup when its
+ * period contains whole months (all time counts as whole months) and only
+ * type / wallet / category conditions apply; the partial months at either
+ * edge are collected from the records. Returns false, touching nothing,
+ * when the rollup cannot help.
+ */
+bool AppController::CollectRollupGroups(const TransactionQuery& query, GroupKey key, TransactionGroups& groups) {
+    if (query.HasAmountRange() || query.HasKeyword() || query.HasFuzzyText()) return false;
+
+    int firstMonth = 0, lastMonth = INT_MAX;
+    bool leadingEdge = false, trailingEdge = false;
+    const Date& start = query.GetStartDate();
+    const Date& end = query.GetEndDate();
+    if (query.HasDateRange()) {
+        leadingEdge = start.GetDay() != 1;
+        trailingEdge = end != Date::GetEndOfMonth(end.GetMonth(), end.GetYear());
+        firstMonth = MonthKey(start) + (leadingEdge ? 1 : 0);
+        lastMonth = MonthKey(end) - (trailingEdge ? 1 : 0);
+        if (firstMonth > lastMonth) return false;
+    }
+
+    rollup->ForEachCell(firstMonth, lastMonth, [&](int month, const RollupKey& cell, const RollupTotals& totals) {
+        GroupValue value;
+        if (CellGroup(query, key, month, cell, value)) groups[value].Merge(totals.count, totals.sum);
+    });
+
+    if (leadingEdge) {
+        CollectGroups(TransactionQuery(query).InDateRange(start, Date::GetEndOfMonth(start.GetMonth(), start.GetYear())), key, false, groups);
+    }
+    if (trailingEdge) {
+        CollectGroups(TransactionQuery(query).InDateRange(Date(1, end.GetMonth(), end.GetYear()), end), key, false, groups);
+    }
+    return true;
 }
 
-ArrayList<Transaction*>* AppController::SearchTransactions(const std::string& keyword) {
+/**
+ * Adds the query's matches to 'groups', by type, from the daily prefix sums
+ * in O(log days) when only a date range and a type apply. Returns false,
+ * touching nothing, otherwise.
+ */
+bool AppController::CollectDailyGroups(const TransactionQuery& query, TransactionGroups& groups) {
+    if (query.HasAmountRange() || query.HasKeyword() || query.HasFuzzyText() ||
+        query.HasWallet() || query.HasCategory()) return false;
+
+    long long firstDay = LLONG_MIN, lastDay = LLONG_MAX;
+    if (query.HasDateRange()) {
+        firstDay = query.GetStartDate().DayNumber();
+        lastDay = query.GetEndDate().DayNumber();
+    }
+
+    for (int type = 0; type < 2; ++type) {
+        if (query.HasType() && type != static_cast<int>(query.GetType())) continue;
+
+        // An empty range may keep rounding residue in its amount; its count is exact
+        QueryTotals totals = dailyTotals[type]->Sum(firstDay, lastDay);
+        if (totals.count > 0) groups[GroupValue::Of(type)].Merge(totals.count, totals.amount);
+    }
+    return true;
+}
+
+/// Cache key of a grouped report: its kind, the grouping column and the query's conditions.
+static std::string ReportKey(char kind, GroupKey key, const TransactionQuery& query) {
+    std::string text(1, kind);
+    text += static_cast<char>('0' + static_cast<int>(key));
+    return text + query.ConditionKey();
+}
+
+/// Adds a period's first and last day to a cache key.
+static void AppendDays(std::string& key, const Date& start, const Date& end) {
+    long long days[2] = { start.DayNumber(), end.DayNumber() };
+    key.append(reinterpret_cast<const char*>(days), sizeof(days));
+}
+
+/// Part of a ComparePeriods period that is read from the records.
+struct PeriodPiece {
+    Date start;
+    Date end;
+    size_t period;
+};
+
+void AppController::ComparePeriods(const TransactionQuery& query, GroupKey key, const Date* starts, const Date* ends, size_t count,
+                                   TransactionGroups* groups) {
     std::lock_guard<std::recursive_mutex> lock(dataMutex);
-    
-    return AppHelpers::Filter(transactions, [keyword](Transaction* t) {
-        return t->GetDescription().find(keyword) != std::string::npos ||
-               t->GetId() == keyword;
+    if (count == 0) return;
+
+    // Cached under the query and every period; stale once any month they span changes
+    std::string cacheKey = ReportKey('C', key, query);
+    Date first = starts[0], last = ends[0];
+    for (size_t i = 0; i < count; ++i) {
+        AppendDays(cacheKey, starts[i], ends[i]);
+        if (starts[i] < first) first = starts[i];
+        if (ends[i] > last) last = ends[i];
+    }
+    if (reportCache->Lookup(cacheKey, groups, count)) return;
+
+    CollectPeriods(query, key, starts, ends, count, groups);
+    reportCache->Store(cacheKey, MonthKey(first), MonthKey(last), groups, count);
+}
+
+void AppController::CollectPeriods(const TransactionQuery& query, GroupKey key, const Date* starts, const Date* ends, size_t count,
+                                   TransactionGroups* groups) {
+    if (key == GroupKey::Type) {
+        bool daily = true;
+        for (size_t i = 0; i < count && daily; ++i) {
+            daily = CollectDailyGroups(TransactionQuery(query).InDateRange(starts[i], ends[i]), groups[i]);
+        }
+        if (daily) return;
+    }
+
+    // Under type / wallet / category conditions only, the whole months inside
+    // each period come from one pass over the rollup cells of all of them
+    // (each cell added to every period holding its month); what is left of
+    // each period, or all of it otherwise, becomes a piece read from the records
+    bool rollupCells = !query.HasAmountRange() && !query.HasKeyword() && !query.HasFuzzyText();
+    ArrayList<PeriodPiece> pieces;
+    ArrayList<int> firstMonths, lastMonths;
+    int unionFirst = INT_MAX, unionLast = INT_MIN;
+    for (size_t i = 0; i < count; ++i) {
+        const Date& start = starts[i];
+        const Date& end = ends[i];
+        bool leadingEdge = start.GetDay() != 1;
+        bool trailingEdge = end != Date::GetEndOfMonth(end.GetMonth(), end.GetYear());
+        int firstMonth = MonthKey(start) + (leadingEdge ? 1 : 0);
+        int lastMonth = MonthKey(end) - (trailingEdge ? 1 : 0);
+
+        if (!rollupCells || firstMonth > lastMonth) {
+            if (start <= end) pieces.Add({start, end, i});
+            firstMonths.Add(0);
+            lastMonths.Add(-1);
+            continue;
+        }
+        if (leadingEdge) pieces.Add({start, Date::GetEndOfMonth(start.GetMonth(), start.GetYear()), i});
+        if (trailingEdge) pieces.Add({Date(1, end.GetMonth(), end.GetYear()), end, i});
+        firstMonths.Add(firstMonth);
+        lastMonths.Add(lastMonth);
+        unionFirst = std::min(unionFirst, firstMonth);
+        unionLast = std::max(unionLast, lastMonth);
+    }
+
+    rollup->ForEachCell(unionFirst, unionLast, [&](int month, const RollupKey& cell, const RollupTotals& totals) {
+        GroupValue value;
+        if (!CellGroup(query, key, month, cell, value)) return;
+
+        for (size_t i = 0; i < count; ++i) {
+            if (firstMonths[i] <= month && month <= lastMonths[i]) groups[i][value].Merge(totals.count, totals.sum);
+        }
     });
+    if (pieces.IsEmpty()) return;
+
+    // Every piece start and every day after a piece end cut the timeline into
+    // segments, each wholly inside or outside every piece. A match is added to
+    // its segment's groups only (one probe, however many pieces overlap
+    // there), and each piece's period then merges the segments it covers
+    ArrayList<long long> cuts;
+    for (size_t i = 0; i < pieces.Count(); ++i) {
+        cuts.Add(pieces[i].start.DayNumber());
+        cuts.Add(pieces[i].end.DayNumber() + 1);
+    }
+    std::sort(cuts.begin(), cuts.end());
+    size_t distinct = 1;
+    for (size_t i = 1; i < cuts.Count(); ++i) {
+        if (cuts[i] != cuts[distinct - 1]) cuts[distinct++] = cuts[i];
+    }
+    size_t segments = distinct - 1;
+    TransactionGroups* partials = new TransactionGroups[segments];
+
+    // The pieces merged into disjoint spans, walked in date order, so no row is visited twice
+    std::sort(pieces.begin(), pieces.end(), [](const PeriodPiece& a, const PeriodPiece& b) { return a.start < b.start; });
+    for (size_t first = 0; first < pieces.Count();) {
+        Date spanStart = pieces[first].start, spanEnd = pieces[first].end;
+        size_t next = first + 1;
+        for (; next < pieces.Count() && pieces[next].start <= spanEnd.AddDays(1); ++next) {
+            if (pieces[next].end > spanEnd) spanEnd = pieces[next].end;
+        }
+        first = next;
+
+        TransactionQuery span = TransactionQuery(query).InDateRange(spanStart, spanEnd);
+        QueryPlan plan;
+        const TransactionLedger* source = ResolvePlan(span, plan);
+        if (plan.path == QueryPlan::Path::Empty || plan.candidateRows == 0) continue;
+
+        // Rows mostly come in date order, so the last segment usually still holds the next row
+        size_t segment = 0;
+        WalkPlan(span, plan, source, [&](Transaction* t) {
+            if (!plan.exact && !span.Matches(t, *descriptions)) return true;
+
+            long long day = t->GetDate().DayNumber();
+            if (day < cuts[segment] || day >= cuts[segment + 1]) {
+                segment = std::upper_bound(cuts.begin(), cuts.begin() + distinct, day) - cuts.begin() - 1;
+            }
+            partials[segment][GroupOf(t, key)].Merge(1, t->GetAmount());
+            return true;
+        });
+    }
+
+    for (size_t i = 0; i < pieces.Count(); ++i) {
+        long long firstDay = pieces[i].start.DayNumber(), lastDay = pieces[i].end.DayNumber();
+        for (size_t segment = 0; segment < segments; ++segment) {
+            if (cuts[segment] >= firstDay && cuts[segment + 1] - 1 <= lastDay) {
+                MergeGroups(partials[segment], false, groups[pieces[i].period]);
+            }
+        }
+    }
+    delete[] partials;
+}
+
+AmountDigests* AppController::DigestBy(const TransactionQuery& query, GroupKey key) {
+    std::lock_guard<std::recursive_mutex> lock(dataMutex);
+    AmountDigests* digests = new AmountDigests();
+
+    QueryPlan plan;
+    const TransactionLedger* source = ResolvePlan(query, plan);
+    if (plan.path == QueryPlan::Path::Empty || plan.candidateRows == 0) return digests;
+
+    WalkPlan(query, plan, source, [&](Transaction* t) {
+        if (!plan.exact && !query.Matches(t, *descriptions)) return true;
+
+        TDigest*& digest = (*digests)[GroupOf(t, key)];
+        if (digest == nullptr) digest = new TDigest();
+        digest->Add(t->GetAmount());
+        return true;
+    });
+    return digests;
+}
+
+TransactionGroups* AppController::GroupBy(const TransactionQuery& query, GroupKey key, bool extremes) {
+    std::lock_guard<std::recursive_mutex> lock(dataMutex);
+    TransactionGroups* groups = new TransactionGroups();
+
+    std::string cacheKey = ReportKey(extremes ? 'G' : 'g', key, query);
+    if (reportCache->Lookup(cacheKey, groups, 1)) return groups;
+
+    if (extremes) {
+        CollectGroups(query, key, true, *groups);
+    }
+    else if (!(key == GroupKey::Type && CollectDailyGroups(query, *groups)) && !CollectRollupGroups(query, key, *groups)) {
+        CollectGroups(query, key, false, *groups);
+    }
+
+    if (query.HasDateRange()) reportCache->Store(cacheKey, MonthKey(query.GetStartDate()), MonthKey(query.GetEndDate()), groups, 1);
+    else reportCache->Store(cacheKey, ReportCache::ALL_MONTHS_FIRST, ReportCache::ALL_MONTHS_LAST, groups, 1);
+    return groups;
 }
 
 void AppController::ClearDatabase() {
@@ -835,23 +1766,40 @@ void AppController::ClearDatabase() {
     ClearIndexMap(walletIndex);
     ClearIndexMap(categoryIndex);
     ClearIndexMap(incomeSourceIndex);
+    slots->Clear();
+    slotAmounts->Clear();
+    vacantSlots = 0;
+    textIndex->Clear();
+    typeRows->Clear();
+    walletRows->Clear();
+    categoryRows->Clear();
+    monthRows->Clear();
+    rollup->Clear();
+    for (FenwickTree<QueryTotals>* daily : dailyTotals) daily->Clear();
+    FreeMapValues(walletDailyFlow);
+    reportCache->Clear();
+    usageCounts->Clear();
+    ++dataGeneration;
     
     // Re-init indices
-    walletIndex = new HashMap<std::string, ArrayList<Transaction*>*>();
-    categoryIndex = new HashMap<std::string, ArrayList<Transaction*>*>();
-    incomeSourceIndex = new HashMap<std::string, ArrayList<Transaction*>*>();
-
-    FreeList(transactions); transactions = new ArrayList<Transaction*>();
+    walletIndex = new HashMap<EntityId, TransactionLedger*>();
+    categoryIndex = new HashMap<EntityId, TransactionLedger*>();
+    incomeSourceIndex = new HashMap<EntityId, TransactionLedger*>();
+
+    delete transactions; transactions = new TransactionLedger();
+    delete amountIndex; amountIndex = new TransactionAmountIndex();
+    transactionStore->Release();
+    descriptions->Clear();
     FreeList(recurringTransactions); recurringTransactions = new ArrayList<RecurringTransaction*>();
     FreeList(walletsList); walletsList = new ArrayList<Wallet*>();
     FreeList(categoriesList); categoriesList = new ArrayList<Category*>();
     FreeList(incomeSourcesList); incomeSourcesList = new ArrayList<IncomeSource*>();
 
-    if (transactionsMap) { delete transactionsMap; transactionsMap = new HashMap<std::string, Transaction*>(); }
-    if (recurringTransactionsMap) { delete recurringTransactionsMap; recurringTransactionsMap = new HashMap<std::string, RecurringTransaction*>(); }
-    if (walletsMap) { delete walletsMap; walletsMap = new HashMap<std::string, Wallet*>(); }
-    if (categoriesMap) { delete categoriesMap; categoriesMap = new HashMap<std::string, Category*>(); }
-    if (incomeSourcesMap) { delete incomeSourcesMap; incomeSourcesMap = new HashMap<std::string, IncomeSource*>(); }
+    if (transactionsMap) { delete transactionsMap; transactionsMap = new HashMap<EntityId, Transaction*>(); }
+    if (recurringTransactionsMap) { delete recurringTransactionsMap; recurringTransactionsMap = new HashMap<EntityId, RecurringTransaction*>(); }
+    if (walletsMap) { delete walletsMap; walletsMap = new HashMap<EntityId, Wallet*>(); }
+    if (categoriesMap) { delete categoriesMap; categoriesMap = new HashMap<EntityId, Category*>(); }
+    if (incomeSourcesMap) { delete incomeSourcesMap; incomeSourcesMap = new HashMap<EntityId, IncomeSource*>(); }
 
     std::remove(FILE_WALLETS.c_str());
     std::remove(FILE_CATEGORIES.c_str());
@@ -861,3 +1809,56 @@ void AppController::ClearDatabase() {
 
     if (view) view->ShowSuccess("All data has been wiped successfully.");
 }
+
+// ==========================================
+// DIAGNOSTICS
+// ==========================================
+
+MemoryReport AppController::GetMemoryReport() {
+    std::lock_guard<std::recursive_mutex> lock(dataMutex);
+
+    MemoryReport report;
+
+    // Tables
+    report.Add(MemoryStats::OfRegion("transactions.records", *transactionStore));
+    report.Add(MemoryStats::OfList("transactions.list", *transactions));
+    report.Add(MemoryStats::OfArena("transactions.text", *descriptions, transactions->Count()));
+    report.Add(MemoryStats::OfOwningList("recurring", *recurringTransactions));
+    report.Add(MemoryStats::OfOwningList("wallets", *walletsList));
+    report.Add(MemoryStats::OfOwningList("categories", *categoriesList));
+    report.Add(MemoryStats::OfOwningList("sources", *incomeSourcesList));
+
+    // ID maps
+    report.Add(MemoryStats::OfMap("map.transactions", *transactionsMap));
+    report.Add(MemoryStats::OfMap("map.recurring", *recurringTransactionsMap));
+    report.Add(MemoryStats::OfMap("map.wallets", *walletsMap));
+    report.Add(MemoryStats::OfMap("map.categories", *categoriesMap));
+    report.Add(MemoryStats::OfMap("map.sources", *incomeSourcesMap));
+
+    // Secondary indexes (map + posting lists)
+    report.Add(MemoryStats::OfIndex("index.wallet", *walletIndex));
+    report.Add(MemoryStats::OfIndex("index.category", *categoryIndex));
+    report.Add(MemoryStats::OfIndex("index.source", *incomeSourceIndex));
+    report.Add(MemoryStats::OfList("index.amount", *amountIndex));
+    report.Add(MemoryStats::OfList("slots", *slots));
+    report.Add(MemoryStats::OfList("slots.amount", *slotAmounts));
+    report.Add(MemoryStats::OfTrigramIndex("index.text", *textIndex));
+    report.Add(MemoryStats::OfBitmapIndex("bitmap.type", *typeRows));
+    report.Add(MemoryStats::OfBitmapIndex("bitmap.wallet", *walletRows));
+    report.Add(MemoryStats::OfBitmapIndex("bitmap.category", *categoryRows));
+    report.Add(MemoryStats::OfBitmapIndex("bitmap.month", *monthRows));
+    report.Add(MemoryStats::OfRollup("rollup.month", *rollup));
+    report.Add(MemoryStats::OfFenwickTree("daily.income", *dailyTotals[static_cast<int>(TransactionType::Income)]));
+    report.Add(MemoryStats::OfFenwickTree("daily.expense", *dailyTotals[static_cast<int>(TransactionType::Expense)]));
+    report.Add(MemoryStats::OfFenwickMap("daily.wallet", *walletDailyFlow));
+    report.Add(MemoryStats::OfMap("usage", *usageCounts));
+
+    MemoryStats cached;
+    cached.name = "cache.reports";
+    cached.count = reportCache->Count();
+    cached.capacity = reportCache->Capacity();
+    cached.bytes = reportCache->BytesReserved();
+    report.Add(cached);
+
+    return report;
+}
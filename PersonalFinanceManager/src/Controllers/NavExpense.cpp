@@ -189,7 +189,7 @@ void NavigationController::HandleViewExpenses() {
         std::string walletName = (w != nullptr) ? w->GetName() : "Unknown Wallet";
         std::string catName = (c != nullptr) ? c->GetName() : "Unknown Category";
 
-        std::string summary = walletName + " | " + catName + " | " + t->GetDate().ToString() + " | " + t->GetDescription();
+        std::string summary = walletName + " | " + catName + " | " + t->GetDate().ToString() + " | " + appController->GetDescription(t);
         std::string data[] = {std::to_string(i + 1), summary, view.FormatCurrency(static_cast<long long>(t->GetAmount()))};
         view.PrintTableRow(data, widths, 3);
     }
@@ -229,7 +229,7 @@ void NavigationController::HandleEditExpense() {
         std::string walletName = (w != nullptr) ? w->GetName() : "Unknown Wallet";
         std::string catName = (c != nullptr) ? c->GetName() : "Unknown Category";
 
-        std::string summary = walletName + " | " + catName + " | " + t->GetDate().ToString() + " | " + t->GetDescription();
+        std::string summary = walletName + " | " + catName + " | " + t->GetDate().ToString() + " | " + appController->GetDescription(t);
         std::string data[] = {std::to_string(i + 1), summary, view.FormatCurrency(static_cast<long long>(t->GetAmount()))};
         view.PrintTableRow(data, widths, 3);
     }
@@ -246,7 +246,7 @@ void NavigationController::HandleEditExpense() {
     view.PrintHeader("EDIT EXPENSE - CURRENT");
     view.PrintText("Current Amount: " + view.FormatCurrency(static_cast<long long>(target->GetAmount())));
     view.PrintText("Current Date   : " + target->GetDate().ToString());
-    view.PrintText("Current Desc   : " + target->GetDescription());
+    view.PrintText("Current Desc   : " + appController->GetDescription(target));
 
     // Get new values
     double newAmount = InputValidator::GetValidMoney("Enter new amount: ");
@@ -290,7 +290,7 @@ void NavigationController::HandleDeleteExpense() {
         std::string walletName = (w != nullptr) ? w->GetName() : "Unknown Wallet";
         std::string catName = (c != nullptr) ? c->GetName() : "Unknown Category";
 
-        std::string summary = walletName + " | " + catName + " | " + t->GetDate().ToString() + " | " + t->GetDescription();
+        std::string summary = walletName + " | " + catName + " | " + t->GetDate().ToString() + " | " + appController->GetDescription(t);
         std::string data[] = {std::to_string(i + 1), summary, view.FormatCurrency(static_cast<long long>(t->GetAmount()))};
         view.PrintTableRow(data, widths, 3);
     }
@@ -351,15 +351,16 @@ void NavigationController::HandleViewCategories() {
     ArrayList<Category*>* cats = appController->GetCategoriesList();
     if (!cats || cats->Count() == 0) { view.ShowInfo("No categories available."); PauseWithMessage("Press any key to continue..."); return; }
 
-    std::string headers[] = {"Index", "ID", "Name"};
-    int widths[] = {8, 20, 40};
-    view.PrintTableHeader(headers, widths, 3);
+    std::string headers[] = {"Index", "ID", "Name", "Used By"};
+    int widths[] = {8, 20, 40, 10};
+    view.PrintTableHeader(headers, widths, 4);
     for (size_t i=0;i<cats->Count();++i) {
         Category* c = cats->Get(i);
-        std::string data[] = {std::to_string((int)i+1), c->GetId(), c->GetName()};
-        view.PrintTableRow(data, widths, 3);
+        std::string used = std::to_string(appController->GetUsage(c->GetId()).Total());
+        std::string data[] = {std::to_string((int)i+1), c->GetId(), c->GetName(), used};
+        view.PrintTableRow(data, widths, 4);
     }
-    view.PrintTableSeparator(widths, 3);
+    view.PrintTableSeparator(widths, 4);
     PauseWithMessage("Press any key to continue...");
 }
 
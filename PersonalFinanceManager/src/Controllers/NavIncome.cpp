@@ -188,7 +188,7 @@ void NavigationController::HandleViewIncome() {
         if (w) walletName = w->GetName();
         
         std::string dateStr = t->GetDate().ToString();
-        std::string desc = t->GetDescription();
+        std::string desc = appController->GetDescription(t);
         if ((int)desc.length() > 28) desc = desc.substr(0, 27) + "~";
 
         std::string data[] = {std::to_string(i + 1), t->GetId(), walletName, view.FormatCurrency(static_cast<long long>(t->GetAmount())), dateStr, desc};
@@ -228,7 +228,7 @@ void NavigationController::HandleEditIncome() {
         Transaction* t = incomes->Get(i);
         Wallet* w = appController->GetWalletById(t->GetWalletId());
         std::string walletName = w ? w->GetName() : "-";
-        std::string data[] = {std::to_string(i + 1), t->GetId(), walletName, view.FormatCurrency(static_cast<long long>(t->GetAmount())), t->GetDate().ToString(), t->GetDescription()};
+        std::string data[] = {std::to_string(i + 1), t->GetId(), walletName, view.FormatCurrency(static_cast<long long>(t->GetAmount())), t->GetDate().ToString(), appController->GetDescription(t)};
         view.PrintTableRow(data, widths, 6);
     }
     view.PrintTableSeparator(widths, 6);
@@ -255,7 +255,7 @@ void NavigationController::HandleEditIncome() {
     view.PrintText("Wallet: " + walletName);
     view.PrintText("Current Amount: " + view.FormatCurrency(static_cast<long long>(target->GetAmount())));
     view.PrintText("Current Date: " + target->GetDate().ToString());
-    view.PrintText("Current Description: " + target->GetDescription());
+    view.PrintText("Current Description: " + appController->GetDescription(target));
 
     double newAmount = InputValidator::GetValidMoney("Enter new amount: ");
     Date newDate = InputValidator::GetValidDate("Enter new date (YYYY-MM-DD) or 'T' for today: ");
@@ -295,7 +295,7 @@ void NavigationController::HandleDeleteIncome() {
             Transaction* t = incomes->Get(i);
             Wallet* w = appController->GetWalletById(t->GetWalletId());
             std::string walletName = w ? w->GetName() : "-";
-            std::string data[] = {std::to_string(i + 1), t->GetId(), walletName, view.FormatCurrency(static_cast<long long>(t->GetAmount())), t->GetDate().ToString(), t->GetDescription()};
+            std::string data[] = {std::to_string(i + 1), t->GetId(), walletName, view.FormatCurrency(static_cast<long long>(t->GetAmount())), t->GetDate().ToString(), appController->GetDescription(t)};
             view.PrintTableRow(data, widths, 6);
         }
         view.PrintTableSeparator(widths, 6);
@@ -362,15 +362,16 @@ void NavigationController::HandleViewSources() {
     ArrayList<IncomeSource*>* srcs = appController->GetIncomeSourcesList();
     if (!srcs || srcs->Count() == 0) { view.ShowInfo("No sources available."); PauseWithMessage("Press any key to continue..."); return; }
 
-    std::string headers[] = {"Index", "ID", "Name"};
-    int widths[] = {8, 20, 40};
-    view.PrintTableHeader(headers, widths, 3);
+    std::string headers[] = {"Index", "ID", "Name", "Used By"};
+    int widths[] = {8, 20, 40, 10};
+    view.PrintTableHeader(headers, widths, 4);
     for (size_t i=0;i<srcs->Count();++i) {
         IncomeSource* s = srcs->Get(i);
-        std::string data[] = {std::to_string((int)i+1), s->GetId(), s->GetName()};
-        view.PrintTableRow(data, widths, 3);
+        std::string used = std::to_string(appController->GetUsage(s->GetId()).Total());
+        std::string data[] = {std::to_string((int)i+1), s->GetId(), s->GetName(), used};
+        view.PrintTableRow(data, widths, 4);
     }
-    view.PrintTableSeparator(widths, 3);
+    view.PrintTableSeparator(widths, 4);
     PauseWithMessage("Press any key to continue...");
 }
 
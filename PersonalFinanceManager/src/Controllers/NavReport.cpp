@@ -1,6 +1,7 @@
 #include "Controllers/NavigationController.h"
 #include "Controllers/AppController.h"
 #include "Utils/PlatformUtils.h"
+#include "Utils/AppHelpers.h"
 
 // Include Models
 #include "Models/Transaction.h"
@@ -16,6 +17,7 @@
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <cmath>
 
 struct ReportStat {
     std::string id;
@@ -23,6 +25,31 @@ struct ReportStat {
     ReportStat(std::string i, double a) : id(i), amount(a) {}
 };
 
+/// Amount total of one group (0 if nothing fell into it).
+static double GroupSum(const TransactionGroups* groups, const GroupValue& value) {
+    const GroupTotals* totals = groups->Get(value);
+    return (totals != nullptr) ? totals->sum : 0;
+}
+
+/// Amount total across every group.
+static double GroupsTotal(const TransactionGroups* groups) {
+    double total = 0;
+    groups->ForEach([&](const GroupValue&, const GroupTotals& totals) { total += totals.sum; });
+    return total;
+}
+
+/// First and last day of month key year * 12 + month - 1.
+static Date MonthStart(int monthKey) { return Date(1, monthKey % 12 + 1, monthKey / 12); }
+static Date MonthEnd(int monthKey) { return Date::GetEndOfMonth(monthKey % 12 + 1, monthKey / 12); }
+
+/// Signed change from 'previous' to 'current' in percent, or "-" when there was nothing before.
+static std::string PercentChange(double current, double previous) {
+    if (previous == 0) return "-";
+    std::ostringstream ss;
+    ss << std::fixed << std::setprecision(1) << std::showpos << (current - previous) / std::abs(previous) * 100.0 << "%";
+    return ss.str();
+}
+
 static bool GetReportDateRange(Date& start, Date& end) {
     ConsoleView view;
     view.ClearScreen();
@@ -73,6 +100,9 @@ void NavigationController::ShowReportsFlow() {
             case '3': HandleIncomeVsExpense(); break;     
             case '4': HandleWalletBalanceOverview(); break; 
             case '5': HandleIncomeBySource(); break;      
+            case '6': HandleMemoryUsage(); break;
+            case '7': HandleLargestExpenses(); break;
+            case '8': HandleSpendingPercentiles(); break;
             default:
                 view.ShowError("Invalid selection. Try again.");
                 PauseWithMessage("Press any key to continue...");
@@ -90,26 +120,11 @@ void NavigationController::HandleMonthlySummary() {
     // In tiêu đề có kèm ngày tháng để báo cáo trông chuyên nghiệp hơn
     view.PrintHeader("FINANCIAL SUMMARY (" + start.ToString() + " - " + end.ToString() + ")");
 
-    double totalIncome = 0;
-    double totalExpense = 0;
-
-    // 2. TÍNH TOÁN (Có lọc theo ngày)
-    ArrayList<Transaction*>* transactions = appController->GetTransactions();
-    
-    if (transactions) {
-        for (size_t i = 0; i < transactions->Count(); ++i) {
-            Transaction* t = transactions->Get(i);
-            
-            // [QUAN TRỌNG] Chỉ tính các giao dịch nằm trong khoảng thời gian đã chọn
-            if (t->GetDate() >= start && t->GetDate() <= end) {
-                if (t->GetType() == TransactionType::Income) {
-                    totalIncome += t->GetAmount();
-                } else if (t->GetType() == TransactionType::Expense) {
-                    totalExpense += t->GetAmount();
-                }
-            }
-        }
-    }
+    // 2. TÍNH TOÁN (Có lọc theo ngày) - grouped by type, from the daily prefix sums in O(log days)
+    TransactionGroups* byType = appController->GroupBy(TransactionQuery().InDateRange(start, end), GroupKey::Type, false);
+    double totalIncome = GroupSum(byType, GroupValue::Of(TransactionType::Income));
+    double totalExpense = GroupSum(byType, GroupValue::Of(TransactionType::Expense));
+    delete byType;
 
     double netBalance = totalIncome - totalExpense;
 
@@ -166,36 +181,14 @@ void NavigationController::HandleSpendingByCategory() {
     int widths[] = {30, 20, 10};
     view.PrintTableHeader(headers, widths, 3);
 
-    // Tính tổng chi phí trong kỳ
-    double totalExpenseInPeriod = 0;
-    ArrayList<Transaction*>* allTrans = appController->GetTransactions();
-    if (allTrans) {
-        for(size_t i=0; i<allTrans->Count(); ++i) {
-            Transaction* t = allTrans->Get(i);
-            if (t->GetType() == TransactionType::Expense && t->GetDate() >= start && t->GetDate() <= end) {
-                totalExpenseInPeriod += t->GetAmount();
-            }
-        }
-    }
+    // The period's expenses grouped by category (whole months from the rollup); the total is the sum of the groups
+    TransactionGroups* byCategory = appController->GroupBy(
+        TransactionQuery().OfType(TransactionType::Expense).InDateRange(start, end), GroupKey::Category, false);
+    double totalExpenseInPeriod = GroupsTotal(byCategory);
 
     for (size_t i = 0; i < categories->Count(); ++i) {
         Category* c = categories->Get(i);
-        
-        // Lấy transaction theo category
-        ArrayList<Transaction*>* transList = appController->GetTransactionsByCategory(c->GetId());
-        
-        double catTotal = 0;
-        if (transList) {
-            for (size_t j = 0; j < transList->Count(); ++j) {
-                Transaction* t = transList->Get(j);
-                
-                // [QUAN TRỌNG] Filter theo ngày
-                if (t->GetDate() >= start && t->GetDate() <= end) {
-                    catTotal += t->GetAmount();
-                }
-            }
-            delete transList;
-        }
+        double catTotal = GroupSum(byCategory, GroupValue::Of(c->GetId()));
 
         if (catTotal > 0) {
             double pct = (totalExpenseInPeriod > 0) ? (catTotal / totalExpenseInPeriod * 100.0) : 0;
@@ -207,6 +200,8 @@ void NavigationController::HandleSpendingByCategory() {
         }
     }
 
+    delete byCategory;
+
     view.PrintTableSeparator(widths, 3);
     view.PrintText("Total Expense in Period: " + view.FormatCurrency((long long)totalExpenseInPeriod));
 
@@ -234,45 +229,16 @@ void NavigationController::HandleIncomeBySource() {
     int widths[] = {30, 20, 10};
     view.PrintTableHeader(headers, widths, 3);
 
-    // Tính tổng thu nhập TRONG KHOẢNG THỜI GIAN ĐÓ để làm mẫu số tính %
-    double totalIncomeInPeriod = 0;
-    
-    // Bước phụ: Cần tính tổng trước để quy ra % (Optional, nhưng làm vậy mới chuẩn report)
-    // Tuy nhiên để code đơn giản và chạy nhanh (O(N)), ta có thể bỏ qua % chính xác tuyệt đối 
-    // hoặc chấp nhận % trên tổng thu nhập tìm được. Ở đây tôi sẽ tính tổng trước.
-    
-    // (Cách tối ưu hơn: Duyệt transaction 1 lần, bỏ vào Map tạm. Nhưng vì cấm STL, ta làm cách nested loop đơn giản)
-    
-    // Để hiển thị đúng %, ta cần tổng thu nhập của giai đoạn này trước
-    ArrayList<Transaction*>* allTrans = appController->GetTransactions();
-    if (allTrans) {
-        for(size_t i=0; i<allTrans->Count(); ++i) {
-            Transaction* t = allTrans->Get(i);
-            if (t->GetType() == TransactionType::Income && t->GetDate() >= start && t->GetDate() <= end) {
-                totalIncomeInPeriod += t->GetAmount();
-            }
-        }
-    }
+    // Gom nhóm theo Source vào Map tạm: whole months from the rollup, partial months read once.
+    // Tổng thu nhập (mẫu số tính %) là tổng các nhóm
+    TransactionGroups* bySource = appController->GroupBy(
+        TransactionQuery().OfType(TransactionType::Income).InDateRange(start, end), GroupKey::Category, false);
+    double totalIncomeInPeriod = GroupsTotal(bySource);
 
-    // Duyệt từng Source để tính tiền
+    // Duyệt từng Source để lấy tiền từ Map
     for (size_t i = 0; i < incomeSources->Count(); ++i) {
         IncomeSource* s = incomeSources->Get(i);
-        
-        // Lấy toàn bộ transaction của Source này
-        ArrayList<Transaction*>* transList = appController->GetTransactionsByIncomeSource(s->GetId());
-        
-        double sourceTotal = 0;
-        if (transList) {
-            for (size_t j = 0; j < transList->Count(); ++j) {
-                Transaction* t = transList->Get(j);
-                
-                // [QUAN TRỌNG] CHỈ CỘNG NẾU NGÀY NẰM TRONG KHOẢNG ĐÃ CHỌN
-                if (t->GetDate() >= start && t->GetDate() <= end) {
-                    sourceTotal += t->GetAmount();
-                }
-            }
-            delete transList; // Dọn dẹp bộ nhớ list tạm
-        }
+        double sourceTotal = GroupSum(bySource, GroupValue::Of(s->GetId()));
 
         // Chỉ hiện những nguồn có tiền > 0 trong kỳ này (cho gọn bảng)
         if (sourceTotal > 0) {
@@ -285,6 +251,8 @@ void NavigationController::HandleIncomeBySource() {
         }
     }
 
+    delete bySource;
+
     view.PrintTableSeparator(widths, 3);
     view.PrintText("Total Income in Period: " + view.FormatCurrency((long long)totalIncomeInPeriod));
     
@@ -292,7 +260,83 @@ void NavigationController::HandleIncomeBySource() {
 }
 
 void NavigationController::HandleIncomeVsExpense() {
-    HandleMonthlySummary(); 
+    view.ClearScreen();
+    view.PrintHeader("PERIOD COMPARISON");
+
+    // Whole-month periods around today: this month, last month, the same month
+    // last year, and the last 12 months against the 12 before them
+    enum { THIS_MONTH, LAST_MONTH, LAST_YEAR_MONTH, LAST_12, PREVIOUS_12, PERIODS };
+    Date today = Date::GetTodayDate();
+    int month = today.GetYear() * 12 + today.GetMonth() - 1;
+    Date starts[PERIODS] = { MonthStart(month), MonthStart(month - 1), MonthStart(month - 12), MonthStart(month - 11), MonthStart(month - 23) };
+    Date ends[PERIODS] = { MonthEnd(month), MonthEnd(month - 1), MonthEnd(month - 12), MonthEnd(month), MonthEnd(month - 12) };
+
+    struct Comparison { const char* name; int current; int previous; };
+    const Comparison comparisons[] = {
+        {"Month over month", THIS_MONTH, LAST_MONTH},
+        {"Year over year", THIS_MONTH, LAST_YEAR_MONTH},
+        {"Rolling 12 months", LAST_12, PREVIOUS_12}
+    };
+
+    // Every period's income and expense at once
+    TransactionGroups byType[PERIODS];
+    appController->ComparePeriods(TransactionQuery(), GroupKey::Type, starts, ends, PERIODS, byType);
+
+    std::string headers[] = {"", "Current", "Previous", "Change", "% Change"};
+    int widths[] = {22, 16, 16, 16, 10};
+    for (const Comparison& c : comparisons) {
+        std::cout << std::endl;
+        view.PrintText(std::string(c.name) + ": " + starts[c.current].ToString() + " - " + ends[c.current].ToString() +
+                       " vs " + starts[c.previous].ToString() + " - " + ends[c.previous].ToString());
+        view.PrintTableHeader(headers, widths, 5);
+
+        double income[2], expense[2];
+        int periods[2] = {c.current, c.previous};
+        for (int side = 0; side < 2; ++side) {
+            income[side] = GroupSum(&byType[periods[side]], GroupValue::Of(TransactionType::Income));
+            expense[side] = GroupSum(&byType[periods[side]], GroupValue::Of(TransactionType::Expense));
+        }
+
+        const char* names[] = {"Income", "Expense", "Net"};
+        double current[] = {income[0], expense[0], income[0] - expense[0]};
+        double previous[] = {income[1], expense[1], income[1] - expense[1]};
+        for (int line = 0; line < 3; ++line) {
+            std::string row[] = {
+                names[line], view.FormatCurrency((long long)current[line]), view.FormatCurrency((long long)previous[line]),
+                view.FormatCurrency((long long)(current[line] - previous[line])), PercentChange(current[line], previous[line])
+            };
+            view.PrintTableRow(row, widths, 5);
+        }
+        view.PrintTableSeparator(widths, 5);
+    }
+
+    // Expense by category for the same periods, in one walk of their union
+    TransactionGroups byCategory[PERIODS];
+    appController->ComparePeriods(TransactionQuery().OfType(TransactionType::Expense), GroupKey::Category, starts, ends, PERIODS, byCategory);
+
+    std::cout << std::endl;
+    view.PrintText("EXPENSE BY CATEGORY");
+    std::string categoryHeaders[] = {"Category", "This month", "Last month", "MoM %", "Last year", "YoY %"};
+    int categoryWidths[] = {20, 16, 16, 10, 16, 10};
+    view.PrintTableHeader(categoryHeaders, categoryWidths, 6);
+
+    ArrayList<Category*>* categories = appController->GetCategoriesList();
+    for (size_t i = 0; i < categories->Count(); ++i) {
+        GroupValue value = GroupValue::Of(categories->Get(i)->GetId());
+        double current = GroupSum(&byCategory[THIS_MONTH], value);
+        double lastMonth = GroupSum(&byCategory[LAST_MONTH], value);
+        double lastYear = GroupSum(&byCategory[LAST_YEAR_MONTH], value);
+        if (current == 0 && lastMonth == 0 && lastYear == 0) continue;
+
+        std::string row[] = {
+            categories->Get(i)->GetName(), view.FormatCurrency((long long)current), view.FormatCurrency((long long)lastMonth),
+            PercentChange(current, lastMonth), view.FormatCurrency((long long)lastYear), PercentChange(current, lastYear)
+        };
+        view.PrintTableRow(row, categoryWidths, 6);
+    }
+    view.PrintTableSeparator(categoryWidths, 6);
+
+    PauseWithMessage("Press any key to continue...");
 }
 
 void NavigationController::HandleWalletBalanceOverview() {
@@ -318,5 +362,186 @@ void NavigationController::HandleWalletBalanceOverview() {
     view.PrintTableSeparator(widths, 3);
     view.PrintText("TOTAL ASSETS: " + view.FormatCurrency((long long)total));
 
+    // Balance over time: the last 5 month ends and today, each read from the
+    // wallet's daily sums in O(log days) instead of replaying its history
+    const int POINTS = 6;
+    Date today = Date::GetTodayDate();
+    Date points[POINTS];
+    std::string seriesHeaders[POINTS + 1] = {"Wallet"};
+    int seriesWidths[POINTS + 1] = {18};
+
+    for (int p = 0; p < POINTS; ++p) {
+        int monthKey = today.GetYear() * 12 + today.GetMonth() - 1 - (POINTS - 1 - p);
+        int year = monthKey / 12, month = monthKey % 12 + 1;
+
+        std::ostringstream label;
+        label << year << "-" << std::setw(2) << std::setfill('0') << month;
+        bool current = p == POINTS - 1;
+        points[p] = current ? today : Date::GetEndOfMonth(month, year);
+        seriesHeaders[p + 1] = current ? "Today" : label.str();
+        seriesWidths[p + 1] = 16;
+    }
+
+    std::cout << std::endl;
+    view.PrintText("BALANCE AT MONTH END");
+    view.PrintTableHeader(seriesHeaders, seriesWidths, POINTS + 1);
+    for (size_t i = 0; i < wallets->Count(); ++i) {
+        Wallet* w = wallets->Get(i);
+
+        std::string row[POINTS + 1] = {w->GetName()};
+        for (int p = 0; p < POINTS; ++p) {
+            row[p + 1] = view.FormatCurrency((long long)appController->GetWalletBalanceAt(w->GetId(), points[p]));
+        }
+        view.PrintTableRow(row, seriesWidths, POINTS + 1);
+    }
+    view.PrintTableSeparator(seriesWidths, POINTS + 1);
+
     PauseWithMessage("Press any key to continue...");
-}   
\ No newline at end of file
+}
+
+void NavigationController::HandleMemoryUsage() {
+    view.ClearScreen();
+    view.PrintHeader("MEMORY USAGE");
+
+    MemoryReport report = appController->GetMemoryReport();
+
+    std::string headers[] = {"Structure", "Count", "Capacity", "KB", "Wasted KB", "Load", "Chain"};
+    int widths[] = {22, 10, 10, 10, 10, 6, 6};
+    view.PrintTableHeader(headers, widths, 7);
+
+    for (size_t i = 0; i < report.entries.Count(); ++i) {
+        const MemoryStats& s = report.entries[i];
+
+        std::ostringstream kb, wasted, load;
+        kb << std::fixed << std::setprecision(1) << s.bytes / 1024.0;
+        wasted << std::fixed << std::setprecision(1) << s.wastedBytes / 1024.0;
+        if (s.isHashTable) load << std::fixed << std::setprecision(2) << s.loadFactor;
+
+        std::string row[] = {
+            s.name, std::to_string(s.count), std::to_string(s.capacity), kb.str(), wasted.str(),
+            load.str(), s.isHashTable ? std::to_string(s.longestChain) : ""
+        };
+        view.PrintTableRow(row, widths, 7);
+    }
+    view.PrintTableSeparator(widths, 7);
+
+    std::ostringstream total;
+    total << std::fixed << std::setprecision(1)
+          << "TOTAL: " << report.TotalBytes() / 1024.0 << " KB"
+          << " (wasted " << report.TotalWastedBytes() / 1024.0 << " KB)";
+    view.PrintText(total.str());
+
+    PauseWithMessage("Press any key to continue...");
+}
+
+void NavigationController::HandleLargestExpenses() {
+    Date start, end;
+    if (!GetReportDateRange(start, end)) return;
+
+    view.ClearScreen();
+    view.PrintHeader("LARGEST EXPENSES (" + start.ToString() + " - " + end.ToString() + ")");
+
+    // Top-K by amount: the query keeps at most 2 x K rows while it walks, however many match
+    const size_t SHOWN = 20;
+    ArrayList<Transaction*>* top = appController->RunQuery(TransactionQuery()
+        .OfType(TransactionType::Expense).InDateRange(start, end).SortBy(QuerySort::AmountDescending).Limit(SHOWN));
+
+    if (top->Count() == 0) {
+        view.ShowInfo("No expenses in this period.");
+        delete top;
+        PauseWithMessage("Press any key to continue...");
+        return;
+    }
+
+    std::string headers[] = {"#", "Date", "Category", "Amount", "Description"};
+    int widths[] = {4, 12, 20, 16, 30};
+    view.PrintTableHeader(headers, widths, 5);
+
+    for (size_t i = 0; i < top->Count(); ++i) {
+        Transaction* t = top->Get(i);
+        Category* c = appController->GetCategoryById(t->GetCategoryId());
+
+        std::string row[] = {
+            std::to_string(i + 1), t->GetDate().ToString(), (c != nullptr) ? c->GetName() : "Unknown Category",
+            view.FormatCurrency((long long)t->GetAmount()), appController->GetDescription(t)
+        };
+        view.PrintTableRow(row, widths, 5);
+    }
+    view.PrintTableSeparator(widths, 5);
+    delete top;
+
+    PauseWithMessage("Press any key to continue...");
+}
+
+void NavigationController::HandleSpendingPercentiles() {
+    Date start, end;
+    if (!GetReportDateRange(start, end)) return;
+
+    view.ClearScreen();
+    view.PrintHeader("SPENDING PERCENTILES (" + start.ToString() + " - " + end.ToString() + ")");
+
+    // One pass per table, one fixed-size quantile sketch per group (approximate, about 1% in rank)
+    TransactionQuery expenses = TransactionQuery().OfType(TransactionType::Expense).InDateRange(start, end);
+    AmountDigests* byCategory = appController->DigestBy(expenses, GroupKey::Category);
+    if (byCategory->IsEmpty()) {
+        view.ShowInfo("No expenses in this period.");
+        delete byCategory;
+        PauseWithMessage("Press any key to continue...");
+        return;
+    }
+
+    std::string headers[] = {"Group", "Count", "Median", "90th %", "Largest"};
+    int widths[] = {20, 8, 16, 16, 16};
+
+    // Per category, then all expenses (the category sketches merged)
+    TDigest all;
+    view.PrintTableHeader(headers, widths, 5);
+    ArrayList<Category*>* categories = appController->GetCategoriesList();
+    for (size_t i = 0; i < categories->Count(); ++i) {
+        TDigest** digest = byCategory->Get(GroupValue::Of(categories->Get(i)->GetId()));
+        if (digest == nullptr) continue;
+
+        std::string row[] = {
+            categories->Get(i)->GetName(), std::to_string((*digest)->Count()),
+            view.FormatCurrency((long long)(*digest)->Quantile(0.5)), view.FormatCurrency((long long)(*digest)->Quantile(0.9)),
+            view.FormatCurrency((long long)(*digest)->Max())
+        };
+        view.PrintTableRow(row, widths, 5);
+    }
+    byCategory->ForEach([&](const GroupValue&, TDigest* digest) { all.Merge(*digest); });
+    AppHelpers::FreeMapValues(byCategory);
+    delete byCategory;
+
+    view.PrintTableSeparator(widths, 5);
+    std::string rowAll[] = {
+        "ALL EXPENSES", std::to_string(all.Count()), view.FormatCurrency((long long)all.Quantile(0.5)),
+        view.FormatCurrency((long long)all.Quantile(0.9)), view.FormatCurrency((long long)all.Max())
+    };
+    view.PrintTableRow(rowAll, widths, 5);
+
+    // Per month of the period
+    AmountDigests* byMonth = appController->DigestBy(expenses, GroupKey::Month);
+    std::cout << std::endl;
+    headers[0] = "Month";
+    view.PrintTableHeader(headers, widths, 5);
+    int firstMonth = start.GetYear() * 12 + start.GetMonth() - 1;
+    int lastMonth = end.GetYear() * 12 + end.GetMonth() - 1;
+    for (int monthKey = firstMonth; monthKey <= lastMonth; ++monthKey) {
+        TDigest** digest = byMonth->Get(GroupValue::Of(monthKey));
+        if (digest == nullptr) continue;
+
+        std::ostringstream label;
+        label << monthKey / 12 << "-" << std::setw(2) << std::setfill('0') << monthKey % 12 + 1;
+        std::string row[] = {
+            label.str(), std::to_string((*digest)->Count()),
+            view.FormatCurrency((long long)(*digest)->Quantile(0.5)), view.FormatCurrency((long long)(*digest)->Quantile(0.9)),
+            view.FormatCurrency((long long)(*digest)->Max())
+        };
+        view.PrintTableRow(row, widths, 5);
+    }
+    view.PrintTableSeparator(widths, 5);
+    AppHelpers::FreeMapValues(byMonth);
+    delete byMonth;
+
+    PauseWithMessage("Press any key to continue...");
+}
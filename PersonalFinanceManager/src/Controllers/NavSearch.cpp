@@ -18,6 +18,44 @@
 
 #include <iostream>
 #include <iomanip>
+#include <limits>
+
+// 6-column layout shared by both PrintTransactionList overloads
+static std::string TRANSACTION_HEADERS[] = {"Date", "Wallet", "Category/Source", "Amount", "Type", "Description"};
+static int TRANSACTION_WIDTHS[] = {12, 20, 20, 15, 8, 25};
+static const int TRANSACTION_COLS = 6;
+
+void NavigationController::PrintTransactionRow(Transaction* t) {
+    // 1. Lấy tên Wallet từ ID
+    Wallet* w = appController->GetWalletById(t->GetWalletId());
+    std::string wName = (w != nullptr) ? w->GetName() : "Unknown";
+
+    // 2. Lấy tên Category (nếu là Expense) hoặc Source (nếu là Income)
+    std::string catName = "Unknown";
+    std::string typeStr = "";
+    
+    if (t->GetType() == TransactionType::Income) {
+        typeStr = "Income";
+        IncomeSource* s = appController->GetIncomeSourceById(t->GetCategoryId());
+        catName = (s != nullptr) ? s->GetName() : "Unknown";
+    } else {
+        typeStr = "Expense";
+        Category* c = appController->GetCategoryById(t->GetCategoryId());
+        catName = (c != nullptr) ? c->GetName() : "Unknown";
+    }
+
+    // 3. Định dạng dữ liệu để in ra bảng
+    std::string data[] = {
+        t->GetDate().ToString(),                        // Date
+        wName,                                          // Wallet Name (Thay vì ID)
+        catName,                                        // Category/Source Name
+        view.FormatCurrency((long long)t->GetAmount()), // Amount có dấu phẩy
+        typeStr,                                        // Type
+        appController->GetDescription(t)                // Description
+    };
+
+    view.PrintTableRow(data, TRANSACTION_WIDTHS, TRANSACTION_COLS);
+}
 
 void NavigationController::PrintTransactionList(ArrayList<Transaction*>* list) {
     if (!list || list->Count() == 0) {
@@ -25,51 +63,24 @@ void NavigationController::PrintTransactionList(ArrayList<Transaction*>* list) {
         return;
     }
 
-    // 1. Cập nhật Header để thêm cột Wallet và Category/Source
-    // Bỏ cột ID đi vì người dùng thường không cần xem ID, họ cần xem tên
-    std::string headers[] = {"Date", "Wallet", "Category/Source", "Amount", "Type", "Description"};
-    
-    // Tăng số lượng cột lên 6 và canh chỉnh độ rộng
-    int numCols = 6;
-    int widths[] = {12, 20, 20, 15, 8, 25}; 
-
-    view.PrintTableHeader(headers, widths, numCols);
-
+    view.PrintTableHeader(TRANSACTION_HEADERS, TRANSACTION_WIDTHS, TRANSACTION_COLS);
     for (size_t i = 0; i < list->Count(); ++i) {
-        Transaction* t = list->Get(i);
-
-        // 2. Lấy tên Wallet từ ID
-        Wallet* w = appController->GetWalletById(t->GetWalletId());
-        std::string wName = (w != nullptr) ? w->GetName() : "Unknown";
-
-        // 3. Lấy tên Category (nếu là Expense) hoặc Source (nếu là Income)
-        std::string catName = "Unknown";
-        std::string typeStr = "";
-        
-        if (t->GetType() == TransactionType::Income) {
-            typeStr = "Income";
-            IncomeSource* s = appController->GetIncomeSourceById(t->GetCategoryId());
-            catName = (s != nullptr) ? s->GetName() : "Unknown";
-        } else {
-            typeStr = "Expense";
-            Category* c = appController->GetCategoryById(t->GetCategoryId());
-            catName = (c != nullptr) ? c->GetName() : "Unknown";
-        }
+        PrintTransactionRow(list->Get(i));
+    }
+    view.PrintTableSeparator(TRANSACTION_WIDTHS, TRANSACTION_COLS);
+}
 
-        // 4. Định dạng dữ liệu để in ra bảng
-        std::string data[] = {
-            t->GetDate().ToString(),                        // Date
-            wName,                                          // Wallet Name (Thay vì ID)
-            catName,                                        // Category/Source Name
-            view.FormatCurrency((long long)t->GetAmount()), // Amount có dấu phẩy
-            typeStr,                                        // Type
-            t->GetDescription()                             // Description
-        };
-
-        view.PrintTableRow(data, widths, numCols);
+void NavigationController::PrintTransactionList(const TransactionView& list) {
+    if (list.IsEmpty()) {
+        view.ShowInfo("No transactions found matching your criteria.");
+        return;
     }
-    
-    view.PrintTableSeparator(widths, numCols);
+
+    view.PrintTableHeader(TRANSACTION_HEADERS, TRANSACTION_WIDTHS, TRANSACTION_COLS);
+    for (Transaction* t : list) {
+        PrintTransactionRow(t);
+    }
+    view.PrintTableSeparator(TRANSACTION_WIDTHS, TRANSACTION_COLS);
 }
 
 // =============================================================
@@ -99,6 +110,9 @@ void NavigationController::ShowSearchFlow() {
             case '6':
                 HandleFilterByDate();
                 break;
+            case '7':
+                HandleAdvancedSearch();
+                break;
             default:
                 view.ShowError("Invalid selection.");
                 PauseWithMessage("Press any key to continue...");
@@ -117,6 +131,23 @@ void NavigationController::HandleSearchByKeyword() {
     
     ArrayList<Transaction*>* results = appController->SearchTransactions(keyword);
     
+    // Nothing exact: try again ignoring upper/lower case
+    if (results->IsEmpty()) {
+        delete results;
+        results = appController->SearchTransactions(keyword, true);
+    }
+    
+    // Still nothing: retry allowing a typo or two (merchant names are easy to misspell)
+    if (results->IsEmpty() && keyword.size() >= 4) {
+        int typos = (keyword.size() >= 8) ? 2 : 1;
+        delete results;
+        results = appController->SearchTransactionsFuzzy(keyword, typos);
+        if (!results->IsEmpty()) {
+            view.PrintText("");
+            view.ShowInfo("No exact match. Showing close matches (up to " + std::to_string(typos) + " typo(s)):");
+        }
+    }
+    
     view.PrintText("");
     PrintTransactionList(results);
     
@@ -152,10 +183,8 @@ void NavigationController::HandleFilterByWallet() {
     view.ClearScreen();
     view.PrintHeader("TRANSACTIONS IN: " + walletName);
     
-    ArrayList<Transaction*>* results = appController->GetTransactionsByWallet(walletId);
-    PrintTransactionList(results);
+    PrintTransactionList(appController->GetTransactionsByWallet(walletId));
     
-    delete results;
     PauseWithMessage("Press any key to continue...");
 }
 
@@ -184,10 +213,8 @@ void NavigationController::HandleFilterByCategory() {
     view.ClearScreen();
     view.PrintHeader("EXPENSES IN: " + catName);
     
-    ArrayList<Transaction*>* results = appController->GetTransactionsByCategory(catId);
-    PrintTransactionList(results);
+    PrintTransactionList(appController->GetTransactionsByCategory(catId));
     
-    delete results;
     PauseWithMessage("Press any key to continue...");
 }
 
@@ -216,10 +243,8 @@ void NavigationController::HandleFilterBySource() {
     view.ClearScreen();
     view.PrintHeader("INCOMES FROM: " + sourceName);
     
-    ArrayList<Transaction*>* results = appController->GetTransactionsByIncomeSource(sourceId);
-    PrintTransactionList(results);
+    PrintTransactionList(appController->GetTransactionsByIncomeSource(sourceId));
     
-    delete results;
     PauseWithMessage("Press any key to continue...");
 }
 
@@ -272,3 +297,76 @@ void NavigationController::HandleFilterByDate() {
     delete results;
     PauseWithMessage("Press any key to continue...");
 }
+
+// ADVANCED SEARCH (all conditions optional, combined with AND)
+void NavigationController::HandleAdvancedSearch() {
+    view.ClearScreen();
+    view.PrintHeader("ADVANCED SEARCH");
+    view.PrintText("Leave any field blank (or 0) to skip that condition.");
+
+    TransactionQuery query;
+
+    // 1. Date range (either end may be open)
+    Date start = InputValidator::GetOptionalDate("Start Date (YYYY-MM-DD): ");
+    Date end   = InputValidator::GetOptionalDate("End Date (YYYY-MM-DD): ");
+    if (start.IsValid() || end.IsValid()) {
+        if (!start.IsValid()) start = Date(1, 1, 1900);
+        if (!end.IsValid()) end = Date(31, 12, 9999);
+        if (start > end) {
+            view.ShowError("Start Date cannot be after End Date.");
+            PauseWithMessage("Press any key to retry...");
+            return;
+        }
+        query.InDateRange(start, end);
+    }
+
+    // 2. Wallet
+    ArrayList<Wallet*>* wallets = appController->GetWalletsList();
+    if (wallets && wallets->Count() > 0) {
+        for (size_t i = 0; i < wallets->Count(); ++i) {
+            std::cout << "  " << (i + 1) << ". " << wallets->Get(i)->GetName() << std::endl;
+        }
+        int idx = InputValidator::GetValidIndex("Wallet (0 = any): ", 0, (int)wallets->Count());
+        if (idx > 0) query.InWallet(wallets->Get(idx - 1)->GetId());
+    }
+
+    // 3. Type
+    int type = InputValidator::GetValidIndex("Type (1 = Income, 2 = Expense, 0 = any): ", 0, 2);
+    if (type == 1) query.OfType(TransactionType::Income);
+    if (type == 2) query.OfType(TransactionType::Expense);
+
+    // 4. Amount range
+    double min = InputValidator::GetOptionalMoney("Min Amount: ");
+    double max = InputValidator::GetOptionalMoney("Max Amount: ");
+    if (min > 0 || max > 0) {
+        if (max <= 0) max = std::numeric_limits<double>::max();
+        if (min > max) {
+            view.ShowError("Error: Minimum amount cannot be greater than Maximum amount.");
+            PauseWithMessage("Press any key to try again...");
+            return;
+        }
+        query.InAmountRange(min, max);
+    }
+
+    // 5. Keyword, order and limit
+    std::string keyword = InputValidator::GetOptionalString("Description contains: ");
+    if (!keyword.empty()) query.Containing(keyword);
+
+    int sort = InputValidator::GetValidIndex("Sort (1 = Newest, 2 = Largest, 3 = Smallest, 0 = Oldest): ", 0, 3);
+    if (sort == 1) query.SortBy(QuerySort::DateDescending);
+    if (sort == 2) query.SortBy(QuerySort::AmountDescending);
+    if (sort == 3) query.SortBy(QuerySort::AmountAscending);
+
+    int limit = InputValidator::GetValidIndex("Max results (0 = all): ", 0, 100000);
+    query.Limit((size_t)limit);
+
+    view.ClearScreen();
+    view.PrintHeader("ADVANCED SEARCH RESULTS");
+    view.ShowInfo("Plan: " + appController->PlanQuery(query).Describe());
+
+    ArrayList<Transaction*>* results = appController->RunQuery(query);
+    PrintTransactionList(results);
+
+    delete results;
+    PauseWithMessage("Press any key to continue...");
+}
@@ -67,15 +67,16 @@ void NavigationController::HandleViewWallets() {
         return;
     }
 
-    std::string headers[] = {"Index", "Wallet Name", "Balance"};
-    int widths[] = {10, 30, 20};
-    view.PrintTableHeader(headers, widths, 3);
+    std::string headers[] = {"Index", "Wallet Name", "Balance", "Used By"};
+    int widths[] = {10, 30, 20, 10};
+    view.PrintTableHeader(headers, widths, 4);
     for (size_t i = 0; i < wallets->Count(); ++i) {
         Wallet* w = wallets->Get(i);
-        std::string data[] = {std::to_string(i + 1), w->GetName(), view.FormatCurrency(static_cast<long long>(w->GetBalance()))};
-        view.PrintTableRow(data, widths, 3);
+        std::string used = std::to_string(appController->GetUsage(w->GetId()).Total());
+        std::string data[] = {std::to_string(i + 1), w->GetName(), view.FormatCurrency(static_cast<long long>(w->GetBalance())), used};
+        view.PrintTableRow(data, widths, 4);
     }
-    view.PrintTableSeparator(widths, 3);
+    view.PrintTableSeparator(widths, 4);
     PauseWithMessage("Press any key to continue...");
 }
 
@@ -7,7 +7,6 @@
 
 #include "Models/Expense.h"
 
-Expense::Expense(std::string id, std::string walletId, std::string catId, double amount, Date date, std::string desc)
-    : Transaction(id, walletId, catId, amount, TransactionType::Expense, date, desc) {
-    // Type is automatically set to Expense by the base constructor call
+Transaction Expense::Create(StringArena& descriptions, std::string id, std::string walletId, std::string catId, double amount, Date date, std::string desc) {
+    return Transaction(descriptions, id, walletId, catId, amount, TransactionType::Expense, date, desc);
 }
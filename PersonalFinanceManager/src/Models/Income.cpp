@@ -7,7 +7,6 @@
 
 #include "Models/Income.h"
 
-Income::Income(std::string id, std::string walletId, std::string catId, double amount, Date date, std::string desc)
-    : Transaction(id, walletId, catId, amount, TransactionType::Income, date, desc) {
-    // Type is automatically set to Income by the base constructor call
+Transaction Income::Create(StringArena& descriptions, std::string id, std::string walletId, std::string catId, double amount, Date date, std::string desc) {
+    return Transaction(descriptions, id, walletId, catId, amount, TransactionType::Income, date, desc);
 }
@@ -6,8 +6,6 @@
 //
 
 #include "Models/Transaction.h"
-#include "Models/Income.h"
-#include "Models/Expense.h"
 #include "Models/RecurringTransaction.h"
 #include "Utils/BinaryFileHelper.h"
 #include <sstream>
@@ -89,14 +87,9 @@ void RecurringTransaction::SetDescription(const std::string& d) { description =
 // 4. AUTOMATION LOGIC
 // ==========================================
 
-Transaction* RecurringTransaction::GenerateTransaction(std::string newTransId, const Date& dateToCreate) {
-    Transaction* t = nullptr;
+Transaction RecurringTransaction::GenerateTransaction(StringArena& descriptions, std::string newTransId, const Date& dateToCreate) {
     std::string recurringDesc = description + " (Auto)";
-    
-    if (type == TransactionType::Income)
-        t = new Income(newTransId, walletId, categoryID, amount, dateToCreate, recurringDesc);
-    else
-        t = new Expense(newTransId, walletId, categoryID, amount, dateToCreate, recurringDesc);
+    Transaction t(descriptions, newTransId, walletId, categoryID, amount, type, dateToCreate, recurringDesc);
     
     lastGeneratedDate = dateToCreate;
     return t;
@@ -0,0 +1,101 @@
+//
+//  ReportCache.cpp
+//  PersonalFinanceManager
+//
+
+#include "Models/ReportCache.h"
+
+// ==========================================
+// 1. CONSTRUCTOR & DESTRUCTOR
+// ==========================================
+
+ReportCache::ReportCache(size_t c) : capacity(c < 1 ? 1 : c), clock(0), hits(0), misses(0), dropped(0) {
+}
+
+ReportCache::~ReportCache() {
+    Clear();
+}
+
+// ==========================================
+// 2. LOOKUP & STORE
+// ==========================================
+
+void ReportCache::Copy(const TransactionGroups& from, TransactionGroups& to) {
+    from.ForEach([&](const GroupValue& value, const GroupTotals& totals) { to[value] = totals; });
+}
+
+/// Frees entry 'index'; the last entry takes its place.
+void ReportCache::Release(size_t index) {
+    Entry* entry = entries[index];
+    delete[] entry->groups;
+    delete entry;
+
+    entries[index] = entries[entries.Count() - 1];
+    entries.RemoveAt(entries.Count() - 1);
+}
+
+bool ReportCache::Lookup(const std::string& key, TransactionGroups* groups, size_t count) {
+    for (size_t i = 0; i < entries.Count(); ++i) {
+        Entry* entry = entries[i];
+        if (entry->count != count || entry->key != key) continue;
+
+        for (size_t g = 0; g < count; ++g) Copy(entry->groups[g], groups[g]);
+        entry->lastUse = ++clock;
+        ++hits;
+        return true;
+    }
+    ++misses;
+    return false;
+}
+
+void ReportCache::Store(const std::string& key, int firstMonth, int lastMonth, const TransactionGroups* groups, size_t count) {
+    // Full: the least recently used result makes room
+    if (entries.Count() == capacity) {
+        size_t oldest = 0;
+        for (size_t i = 1; i < entries.Count(); ++i) {
+            if (entries[i]->lastUse < entries[oldest]->lastUse) oldest = i;
+        }
+        Release(oldest);
+    }
+
+    Entry* entry = new Entry();
+    entry->key = key;
+    entry->firstMonth = firstMonth;
+    entry->lastMonth = lastMonth;
+    entry->groups = new TransactionGroups[count];
+    entry->count = count;
+    entry->lastUse = ++clock;
+    for (size_t g = 0; g < count; ++g) Copy(groups[g], entry->groups[g]);
+    entries.Add(entry);
+}
+
+// ==========================================
+// 3. INVALIDATION
+// ==========================================
+
+void ReportCache::Invalidate(int month) {
+    for (size_t i = entries.Count(); i-- > 0;) {
+        if (entries[i]->firstMonth <= month && month <= entries[i]->lastMonth) {
+            Release(i);
+            ++dropped;
+        }
+    }
+}
+
+void ReportCache::Clear() {
+    while (!entries.IsEmpty()) Release(entries.Count() - 1);
+}
+
+// ==========================================
+// 4. DIAGNOSTICS
+// ==========================================
+
+size_t ReportCache::BytesReserved() const {
+    size_t bytes = entries.BytesReserved();
+    for (size_t i = 0; i < entries.Count(); ++i) {
+        const Entry* entry = entries[i];
+        bytes += sizeof(Entry) + entry->key.capacity() + entry->count * sizeof(TransactionGroups);
+        for (size_t g = 0; g < entry->count; ++g) bytes += entry->groups[g].BytesReserved();
+    }
+    return bytes;
+}
@@ -6,9 +6,10 @@
 //
 
 #include "Models/Transaction.h"
-#include "Models/Income.h"
-#include "Models/Expense.h"
+#include "Utils/TextScan.h"
+#include "Utils/TrigramIndex.h"
 
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 
@@ -17,47 +18,81 @@
 // ==========================================
 
 Transaction::Transaction()
-    : amount(0.0), type(TransactionType::Expense) {
+    : id(), walletId(), categoryId(), amount(0.0), type(TransactionType::Expense), description{0, 0}, sequence(0), slot(0) {
 }
 
-Transaction::Transaction(std::string id, std::string walletId, std::string catId, double amount, TransactionType type, Date date, std::string desc)
-    : id(id), walletId(walletId), categoryId(catId),
-      amount(amount), type(type), date(date), description(desc) {
+Transaction::Transaction(StringArena& descriptions, std::string id, std::string walletId, std::string catId, double amount, TransactionType type, Date date, std::string desc)
+    : id(EntityId::FromString(id)), walletId(EntityId::FromString(walletId)), categoryId(EntityId::FromString(catId)),
+      amount(amount), date(date), type(type), description(descriptions.Append(desc)), sequence(0), slot(0) {
 }
 
 // ==========================================
 // 2. GETTERS
 // ==========================================
 
-std::string Transaction::GetId() const { return id; }
-std::string Transaction::GetWalletId() const { return walletId; }
-std::string Transaction::GetCategoryId() const { return categoryId; }
+std::string Transaction::GetId() const { return id.ToString(); }
+std::string Transaction::GetWalletId() const { return walletId.ToString(); }
+std::string Transaction::GetCategoryId() const { return categoryId.ToString(); }
 double Transaction::GetAmount() const { return amount; }
 Date Transaction::GetDate() const { return date; }
 TransactionType Transaction::GetType() const { return type; }
-std::string Transaction::GetDescription() const { return description; }
+std::string Transaction::GetDescription(const StringArena& descriptions) const { return descriptions.Get(description); }
+
+std::string_view Transaction::GetDescriptionView(const StringArena& descriptions) const {
+    return std::string_view(descriptions.Data(description), description.length);
+}
+
+bool Transaction::DescriptionContains(const StringArena& descriptions, const std::string& needle, bool ignoreCase) const {
+    // Case-sensitive find() already skips ahead with the library's memchr
+    if (!ignoreCase) return GetDescriptionView(descriptions).find(needle) != std::string_view::npos;
+    return TextScan::Contains(descriptions.Data(description), description.length, needle.data(), needle.size(), ignoreCase);
+}
+
+bool Transaction::DescriptionResembles(const StringArena& descriptions, const std::string& pattern, int maxEdits) const {
+    return TrigramIndex::ContainsApproximately(descriptions.Data(description), description.length,
+                                               pattern.data(), pattern.size(), maxEdits);
+}
 
 // ==========================================
 // 3. SETTERS
 // ==========================================
 
 void Transaction::SetAmount(double a) { amount = a; }
-void Transaction::SetWalletId(const std::string& w) { walletId = w; }
-void Transaction::SetCategoryId(const std::string& c) { categoryId = c; }
-void Transaction::SetDescription(const std::string& d) { description = d; }
+void Transaction::SetWalletId(const std::string& w) { walletId = EntityId::FromString(w); }
+void Transaction::SetCategoryId(const std::string& c) { categoryId = EntityId::FromString(c); }
 void Transaction::SetDate(const Date& d) { date = d; }
 
+void Transaction::SetDescription(StringArena& descriptions, const std::string& d) {
+    if (description.length == d.size() &&
+        std::memcmp(descriptions.Data(description), d.data(), d.size()) == 0) return;
+    ReleaseDescription(descriptions);
+    description = descriptions.Append(d);
+}
+
+// ==========================================
+// 3.1. DESCRIPTION STORAGE
+// ==========================================
+
+void Transaction::ReleaseDescription(StringArena& descriptions) {
+    descriptions.Release(description);
+    description = StringRef{0, 0};
+}
+
+void Transaction::MoveDescription(const StringArena& from, StringArena& to) {
+    description = to.Append(from.Data(description), description.length);
+}
+
 // ==========================================
 // 4. DISPLAY
 // ==========================================
 
-std::string Transaction::ToString() const {
+std::string Transaction::ToString(const StringArena& descriptions) const {
     std::stringstream ss;
     // Format: YYYY-MM-DD | +/- 00.00 | Description
     ss << date << " | "
        << (type == TransactionType::Income ? "+ " : "- ")
        << std::fixed << std::setprecision(2) << amount
-       << " | " << description;
+       << " | " << GetDescription(descriptions);
     return ss.str();
 }
 
@@ -65,34 +100,37 @@ std::string Transaction::ToString() const {
 // 5. SERIALIZATION (CORE LOGIC)
 // ==========================================
 
-void Transaction::ToBinary(std::ofstream& fout) const {
-    // 1. Write the Type Identifier FIRST (for polymorphism)
+void Transaction::ToBinary(std::ofstream& fout, const StringArena& descriptions) const {
+    // 1. Write the Type Identifier FIRST
     BinaryFileHelper::Write<int>(fout, static_cast<int>(type));
     
     // 2. Write common fields
-    BinaryFileHelper::WriteString(fout, id);
-    BinaryFileHelper::WriteString(fout, walletId);
-    BinaryFileHelper::WriteString(fout, categoryId);
+    BinaryFileHelper::WriteEntityId(fout, id);
+    BinaryFileHelper::WriteEntityId(fout, walletId);
+    BinaryFileHelper::WriteEntityId(fout, categoryId);
     BinaryFileHelper::Write<double>(fout, amount);
     BinaryFileHelper::WriteDate(fout, date);
-    BinaryFileHelper::WriteString(fout, description);
+    
+    // Description: same layout as WriteString, straight from the arena
+    BinaryFileHelper::Write<size_t>(fout, description.length);
+    if (description.length > 0) fout.write(descriptions.Data(description), description.length);
 }
 
-Transaction* Transaction::FromBinary(std::ifstream& fin) {
+Transaction Transaction::FromBinary(std::ifstream& fin, StringArena& descriptions) {
+    Transaction t;
+    
     // 1. Read the Type Identifier
-    int typeCode = BinaryFileHelper::Read<int>(fin);
-    TransactionType type = static_cast<TransactionType>(typeCode);
+    t.type = static_cast<TransactionType>(BinaryFileHelper::Read<int>(fin));
+    
+    // 2. Read Common Fields (IDs inline, description straight into the arena)
+    t.id = BinaryFileHelper::ReadEntityId(fin);
+    t.walletId = BinaryFileHelper::ReadEntityId(fin);
+    t.categoryId = BinaryFileHelper::ReadEntityId(fin);
+    t.amount = BinaryFileHelper::Read<double>(fin);
+    t.date = BinaryFileHelper::ReadDate(fin);
     
-    // 2. Read Common Fields
-    std::string id = BinaryFileHelper::ReadString(fin);
-    std::string wId = BinaryFileHelper::ReadString(fin);
-    std::string catId = BinaryFileHelper::ReadString(fin);
-    double amt = BinaryFileHelper::Read<double>(fin);
-    Date d = BinaryFileHelper::ReadDate(fin);
-    std::string desc = BinaryFileHelper::ReadString(fin);
+    size_t length = BinaryFileHelper::Read<size_t>(fin);
+    t.description = descriptions.AppendFromStream(fin, length);
     
-    // 3. Factory Logic: Decide which class to instantiate
-    if (type == TransactionType::Income)
-        return new Income(id, wId, catId, amt, d, desc);
-    else return new Expense(id, wId, catId, amt, d, desc);
+    return t;
 }
@@ -0,0 +1,176 @@
+//
+//  TransactionQuery.cpp
+//  PersonalFinanceManager
+//
+
+#include "Models/TransactionQuery.h"
+#include "Models/Transaction.h"
+#include "Utils/TrigramIndex.h"
+
+// ==========================================
+// 1. CONSTRUCTOR
+// ==========================================
+
+TransactionQuery::TransactionQuery()
+    : hasDateRange(false), hasAmountRange(false), minAmount(0.0), maxAmount(0.0),
+      hasType(false), type(TransactionType::Expense), hasWallet(false), walletKey(), hasCategory(false), categoryKey(),
+      hasKeyword(false), keyword(), keywordIgnoresCase(false), hasFuzzyText(false), fuzzyText(), maxEdits(0), sort(QuerySort::DateAscending), limit(0) {
+}
+
+// ==========================================
+// 2. BUILDER
+// ==========================================
+
+TransactionQuery& TransactionQuery::InDateRange(const Date& start, const Date& end) {
+    hasDateRange = true;
+    startDate = start;
+    endDate = end;
+    return *this;
+}
+
+TransactionQuery& TransactionQuery::InAmountRange(double min, double max) {
+    hasAmountRange = true;
+    minAmount = min;
+    maxAmount = max;
+    return *this;
+}
+
+TransactionQuery& TransactionQuery::OfType(TransactionType t) {
+    hasType = true;
+    type = t;
+    return *this;
+}
+
+TransactionQuery& TransactionQuery::InWallet(const std::string& walletId) {
+    hasWallet = true;
+    walletKey = EntityId::FromString(walletId);
+    return *this;
+}
+
+TransactionQuery& TransactionQuery::InCategory(const std::string& categoryId) {
+    hasCategory = true;
+    categoryKey = EntityId::FromString(categoryId);
+    return OfType(TransactionType::Expense);
+}
+
+TransactionQuery& TransactionQuery::FromSource(const std::string& sourceId) {
+    hasCategory = true;
+    categoryKey = EntityId::FromString(sourceId);
+    return OfType(TransactionType::Income);
+}
+
+TransactionQuery& TransactionQuery::Containing(const std::string& text, bool ignoreCase) {
+    hasKeyword = true;
+    keyword = text;
+    keywordIgnoresCase = ignoreCase;
+    return *this;
+}
+
+TransactionQuery& TransactionQuery::Resembling(const std::string& text, int edits) {
+    hasFuzzyText = true;
+    fuzzyText = text.substr(0, TrigramIndex::MAX_FUZZY_LENGTH);
+    maxEdits = (edits < 0) ? 0 : (edits > TrigramIndex::MAX_EDITS ? TrigramIndex::MAX_EDITS : edits);
+    return *this;
+}
+
+TransactionQuery& TransactionQuery::SortBy(QuerySort order) {
+    sort = order;
+    return *this;
+}
+
+TransactionQuery& TransactionQuery::Limit(size_t maxResults) {
+    limit = maxResults;
+    return *this;
+}
+
+// ==========================================
+// 3. EVALUATION
+// ==========================================
+
+bool TransactionQuery::Matches(const Transaction* t, const StringArena& descriptions, bool keywordChecked) const {
+    if (hasType && t->GetType() != type) return false;
+    if (hasWallet && t->GetWalletKey() != walletKey) return false;
+    if (hasCategory && t->GetCategoryKey() != categoryKey) return false;
+
+    if (hasAmountRange) {
+        double amount = t->GetAmount();
+        if (amount < minAmount || amount > maxAmount) return false;
+    }
+
+    if (hasDateRange) {
+        Date d = t->GetDate();
+        if (d < startDate || d > endDate) return false;
+    }
+
+    if (hasKeyword && !keywordChecked && !t->DescriptionContains(descriptions, keyword, keywordIgnoresCase)) return false;
+    if (hasFuzzyText && !t->DescriptionResembles(descriptions, fuzzyText, maxEdits)) return false;
+
+    return true;
+}
+
+/// Appends the bytes of a plain value to a key.
+template <typename T>
+static void AppendBytes(std::string& key, const T& value) {
+    key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+std::string TransactionQuery::ConditionKey() const {
+    std::string key;
+    key.reserve(64);
+
+    // Unset conditions add a single flag byte, so differently built queries never collide
+    key += hasDateRange ? 'D' : '-';
+    if (hasDateRange) {
+        AppendBytes(key, startDate.DayNumber());
+        AppendBytes(key, endDate.DayNumber());
+    }
+    key += hasAmountRange ? 'A' : '-';
+    if (hasAmountRange) {
+        AppendBytes(key, minAmount);
+        AppendBytes(key, maxAmount);
+    }
+    key += hasType ? static_cast<char>('0' + static_cast<int>(type)) : '-';
+
+    std::string wallet = walletKey.ToString(), category = categoryKey.ToString();
+    key += hasWallet ? 'W' : '-';
+    AppendBytes(key, wallet.size());
+    key += wallet;
+    key += hasCategory ? 'C' : '-';
+    AppendBytes(key, category.size());
+    key += category;
+
+    key += hasKeyword ? (keywordIgnoresCase ? 'k' : 'K') : '-';
+    if (hasKeyword) {
+        AppendBytes(key, keyword.size());
+        key += keyword;
+    }
+    key += hasFuzzyText ? 'F' : '-';
+    if (hasFuzzyText) {
+        AppendBytes(key, maxEdits);
+        AppendBytes(key, fuzzyText.size());
+        key += fuzzyText;
+    }
+    return key;
+}
+
+// ==========================================
+// 4. QUERY PLAN
+// ==========================================
+
+std::string QueryPlan::Describe() const {
+    std::string text;
+    switch (path) {
+        case Path::Empty:         return "no matching index entry: 0 rows scanned";
+        case Path::Ledger:        text = dateSeek ? "date range seek" : "full scan"; break;
+        case Path::WalletIndex:   text = "wallet index"; break;
+        case Path::CategoryIndex: text = "category index"; break;
+        case Path::SourceIndex:   text = "source index"; break;
+        case Path::AmountIndex:   text = amountSeek ? "amount range seek" : "amount index"; break;
+        case Path::TrigramIndex:  text = fuzzy ? "trigram index (fuzzy)" : "trigram index"; break;
+        case Path::Bitmap:        text = exact ? "column bitmaps (exact)" : "column bitmaps"; break;
+    }
+    if (dateSeek && path != Path::Ledger) text += " + date seek";
+    if (!ordered) text += " + sort";
+
+    return text + ": " + std::to_string(candidateRows) + " of " + std::to_string(totalRows) + " rows";
+}
@@ -7,6 +7,8 @@
 
 #include "Utils/BinaryFileHelper.h"
 
+#include <stdexcept>
+
 // ==========================================
 // WRITING FUNCTIONS
 // ==========================================
@@ -23,6 +25,12 @@ void BinaryFileHelper::WriteDate(std::ofstream& fout, const Date& value) {
     Write<int>(fout, value.GetYear());
 }
 
+void BinaryFileHelper::WriteEntityId(std::ofstream& fout, const EntityId& value) {
+    size_t length = value.length;
+    Write<size_t>(fout, length);
+    if (length > 0) fout.write(value.text, length);
+}
+
 // ==========================================
 // READING FUNCTIONS
 // ==========================================
@@ -45,3 +53,14 @@ Date BinaryFileHelper::ReadDate(std::ifstream& fin) {
     int y = Read<int>(fin);
     return Date(d, m, y);
 }
+
+EntityId BinaryFileHelper::ReadEntityId(std::ifstream& fin) {
+    size_t length = Read<size_t>(fin);
+    // IDs are generated well below CAPACITY; a longer one means a damaged or foreign file
+    if (length > EntityId::CAPACITY)
+        throw std::runtime_error("Data file holds an entity ID of " + std::to_string(length) + " characters");
+
+    char buffer[EntityId::CAPACITY];
+    fin.read(buffer, length);
+    return EntityId::FromChars(buffer, length);
+}
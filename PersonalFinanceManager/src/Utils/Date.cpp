@@ -18,8 +18,6 @@
 Date::Date(): day(0), month(0), year(0) { }
 Date::Date(int d, int m, int y) : day(d), month(m), year(y) { }
 
-Date::~Date() = default;
-
 // ==========================================
 // 2. GETTERS
 // ==========================================
@@ -134,6 +132,16 @@ Date Date::GetEndOfMonth(int m, int y) {
     return Date(DaysInMonth(m, y), m, y);
 }
 
+long long Date::DayNumber() const {
+    // Counts from 1 March, so the leap day ends its (400-year) era
+    long long y = year - (month <= 2 ? 1 : 0);
+    long long era = (y >= 0 ? y : y - 399) / 400;
+    long long yearOfEra = y - era * 400;
+    long long dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    long long dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
+
 bool Date::IsValid() const {
     if (year < 1900 || month < 1 || month > 12 || day < 1) return false;
     return day <= DaysInMonth(month, year);
@@ -0,0 +1,39 @@
+//
+//  EntityId.cpp
+//  PersonalFinanceManager
+//
+
+#include "Utils/EntityId.h"
+
+static uint8_t ParsePrefixTag(const char* text, size_t length) {
+    if (length < 4 || text[3] != '-') return 0;
+
+    static const IdPrefix prefixes[] = {
+        IdPrefix::Transaction, IdPrefix::Wallet, IdPrefix::Category,
+        IdPrefix::IncomeSource, IdPrefix::Recurring
+    };
+
+    for (IdPrefix p : prefixes) {
+        std::string tag = EnumHelper::IdPrefixToString(p);
+        if (std::memcmp(text, tag.c_str(), 3) == 0)
+            return static_cast<uint8_t>(static_cast<int>(p) + 1);
+    }
+    return 0;
+}
+
+EntityId EntityId::FromChars(const char* str, size_t length) {
+    EntityId id{};
+    if (length == 0 || length > CAPACITY) return id;
+
+    std::memcpy(id.text, str, length);
+    id.length = static_cast<uint8_t>(length);
+    id.prefix = ParsePrefixTag(id.text, id.length);
+
+    // DJB2, same as Hasher<std::string>
+    uint32_t hash = 5381;
+    for (size_t i = 0; i < id.length; ++i)
+        hash = ((hash << 5) + hash) + static_cast<unsigned char>(id.text[i]);
+    id.hashCode = hash;
+
+    return id;
+}
@@ -0,0 +1,60 @@
+//
+//  MemoryStats.cpp
+//  PersonalFinanceManager
+//
+
+#include "Utils/MemoryStats.h"
+
+#include <iomanip>
+#include <ostream>
+
+size_t MemoryReport::TotalBytes() const {
+    size_t total = 0;
+    for (const MemoryStats& s : entries) total += s.bytes;
+    return total;
+}
+
+size_t MemoryReport::TotalWastedBytes() const {
+    size_t total = 0;
+    for (const MemoryStats& s : entries) total += s.wastedBytes;
+    return total;
+}
+
+void MemoryReport::Print(std::ostream& out) const {
+    out << std::left << std::setw(24) << "structure"
+        << std::right << std::setw(12) << "count"
+        << std::setw(12) << "capacity"
+        << std::setw(14) << "bytes"
+        << std::setw(14) << "wasted"
+        << std::setw(8) << "load"
+        << std::setw(10) << "maxchain" << "\n";
+
+    for (const MemoryStats& s : entries) {
+        out << std::left << std::setw(24) << s.name
+            << std::right << std::setw(12) << s.count
+            << std::setw(12) << s.capacity
+            << std::setw(14) << s.bytes
+            << std::setw(14) << s.wastedBytes;
+
+        if (s.isHashTable) {
+            out << std::setw(8) << std::fixed << std::setprecision(2) << s.loadFactor
+                << std::setw(10) << s.longestChain;
+        }
+        out << "\n";
+    }
+
+    out << std::left << std::setw(24) << "TOTAL"
+        << std::right << std::setw(38) << TotalBytes()
+        << std::setw(14) << TotalWastedBytes() << "\n\n";
+
+    // Chain length distribution: buckets holding 0, 1, 2, 3 and 4+ nodes
+    out << "chain histogram (buckets with 0 / 1 / 2 / 3 / 4+ nodes)\n";
+    for (const MemoryStats& s : entries) {
+        if (!s.isHashTable) continue;
+
+        out << std::left << std::setw(24) << s.name << std::right;
+        for (size_t i = 0; i < MemoryStats::CHAIN_BINS; ++i)
+            out << std::setw(12) << s.chainHistogram[i];
+        out << "\n";
+    }
+}
@@ -0,0 +1,397 @@
+//
+//  RoaringBitmap.cpp
+//  PersonalFinanceManager
+//
+
+#include "Utils/RoaringBitmap.h"
+
+#include <algorithm>
+
+// An array this many times shorter than its partner probes it by binary search instead of merging
+static const uint32_t PROBE_SKEW = 16;
+
+static bool TestBit(const uint64_t* words, uint16_t low) {
+    return (words[low >> 6] >> (low & 63)) & 1;
+}
+
+static uint32_t CountBits(const uint64_t* words) {
+    uint32_t count = 0;
+    for (uint32_t w = 0; w < RoaringBitmap::BITSET_WORDS; ++w) count += RoaringBitmap::PopCount(words[w]);
+    return count;
+}
+
+// ==========================================
+// 1. CONTAINERS
+// ==========================================
+
+bool RoaringBitmap::Container::Contains(uint16_t low) const {
+    if (IsBitset()) return TestBit(words, low);
+    return std::binary_search(values, values + count, low);
+}
+
+void RoaringBitmap::Container::Reserve(uint32_t needed) {
+    if (needed <= capacity) return;
+
+    uint32_t grown = (capacity == 0) ? 4 : capacity * 2;
+    while (grown < needed) grown *= 2;
+    if (grown > ARRAY_LIMIT) grown = ARRAY_LIMIT;
+
+    uint16_t* moved = new uint16_t[grown];
+    std::copy(values, values + count, moved);
+    delete[] values;
+    values = moved;
+    capacity = grown;
+}
+
+bool RoaringBitmap::Container::Add(uint16_t low) {
+    if (!IsBitset() && count == ARRAY_LIMIT) ToBitset();
+
+    if (IsBitset()) {
+        uint64_t bit = uint64_t(1) << (low & 63);
+        if (words[low >> 6] & bit) return false;
+        words[low >> 6] |= bit;
+        ++count;
+        return true;
+    }
+
+    // Ascending ids append
+    if (count == 0 || values[count - 1] < low) {
+        Reserve(count + 1);
+        values[count++] = low;
+        return true;
+    }
+
+    uint16_t* at = std::lower_bound(values, values + count, low);
+    if (*at == low) return false;
+
+    size_t index = at - values;
+    Reserve(count + 1);
+    std::copy_backward(values + index, values + count, values + count + 1);
+    values[index] = low;
+    ++count;
+    return true;
+}
+
+bool RoaringBitmap::Container::Remove(uint16_t low) {
+    if (IsBitset()) {
+        uint64_t bit = uint64_t(1) << (low & 63);
+        if (!(words[low >> 6] & bit)) return false;
+        words[low >> 6] &= ~bit;
+        --count;
+
+        // Shrink well below the limit, so a count hovering at it does not flip forms on every call
+        if (count < ARRAY_LIMIT / 2) ToArray();
+        return true;
+    }
+
+    uint16_t* at = std::lower_bound(values, values + count, low);
+    if (at == values + count || *at != low) return false;
+
+    std::copy(at + 1, values + count, at);
+    --count;
+    return true;
+}
+
+void RoaringBitmap::Container::ToBitset() {
+    uint64_t* bits = new uint64_t[BITSET_WORDS]();
+    for (uint32_t i = 0; i < count; ++i) bits[values[i] >> 6] |= uint64_t(1) << (values[i] & 63);
+
+    delete[] values;
+    values = nullptr;
+    capacity = 0;
+    words = bits;
+}
+
+void RoaringBitmap::Container::ToArray() {
+    uint16_t* sorted = (count > 0) ? new uint16_t[count] : nullptr;
+    uint32_t n = 0;
+    for (uint32_t w = 0; w < BITSET_WORDS; ++w) {
+        for (uint64_t word = words[w]; word != 0; word &= word - 1) {
+            sorted[n++] = static_cast<uint16_t>((w << 6) | LowestBit(word));
+        }
+    }
+
+    delete[] words;
+    words = nullptr;
+    values = sorted;
+    capacity = count;
+}
+
+void RoaringBitmap::Container::Normalize() {
+    if (IsBitset() && count <= ARRAY_LIMIT) ToArray();
+    else if (!IsBitset() && count > ARRAY_LIMIT) ToBitset();
+}
+
+RoaringBitmap::Container* RoaringBitmap::Container::Clone() const {
+    Container* copy = new Container(key);
+    copy->count = count;
+    if (IsBitset()) {
+        copy->words = new uint64_t[BITSET_WORDS];
+        std::copy(words, words + BITSET_WORDS, copy->words);
+    }
+    else if (count > 0) {
+        copy->values = new uint16_t[count];
+        copy->capacity = count;
+        std::copy(values, values + count, copy->values);
+    }
+    return copy;
+}
+
+void RoaringBitmap::Container::And(const Container& other) {
+    if (IsBitset() && other.IsBitset()) {
+        for (uint32_t w = 0; w < BITSET_WORDS; ++w) words[w] &= other.words[w];
+        count = CountBits(words);
+        Normalize();
+        return;
+    }
+
+    if (IsBitset()) {
+        // The result fits in the other side's array
+        uint16_t* kept = (other.count > 0) ? new uint16_t[other.count] : nullptr;
+        uint32_t n = 0;
+        for (uint32_t i = 0; i < other.count; ++i) {
+            if (TestBit(words, other.values[i])) kept[n++] = other.values[i];
+        }
+        delete[] words;
+        words = nullptr;
+        values = kept;
+        capacity = other.count;
+        count = n;
+        return;
+    }
+
+    // Array on this side: filter in place
+    uint32_t n = 0;
+    if (other.IsBitset()) {
+        for (uint32_t i = 0; i < count; ++i) {
+            if (TestBit(other.words, values[i])) values[n++] = values[i];
+        }
+    }
+    else if (count * PROBE_SKEW < other.count) {
+        for (uint32_t i = 0; i < count; ++i) {
+            if (std::binary_search(other.values, other.values + other.count, values[i])) values[n++] = values[i];
+        }
+    }
+    else {
+        uint32_t j = 0;
+        for (uint32_t i = 0; i < count && j < other.count; ) {
+            if (values[i] < other.values[j]) ++i;
+            else if (other.values[j] < values[i]) ++j;
+            else {
+                values[n++] = values[i];
+                ++i;
+                ++j;
+            }
+        }
+    }
+    count = n;
+}
+
+void RoaringBitmap::Container::Or(const Container& other) {
+    if (!IsBitset() && !other.IsBitset() && count + other.count <= ARRAY_LIMIT) {
+        uint16_t* merged = new uint16_t[count + other.count];
+        uint16_t* end = std::set_union(values, values + count, other.values, other.values + other.count, merged);
+        delete[] values;
+        values = merged;
+        capacity = count + other.count;
+        count = static_cast<uint32_t>(end - merged);
+        return;
+    }
+
+    if (!IsBitset()) ToBitset();
+    if (other.IsBitset()) {
+        for (uint32_t w = 0; w < BITSET_WORDS; ++w) words[w] |= other.words[w];
+        count = CountBits(words);
+    }
+    else {
+        for (uint32_t i = 0; i < other.count; ++i) {
+            uint16_t low = other.values[i];
+            uint64_t bit = uint64_t(1) << (low & 63);
+            if (!(words[low >> 6] & bit)) ++count;
+            words[low >> 6] |= bit;
+        }
+    }
+    Normalize(); // Overlap may leave few enough for an array
+}
+
+void RoaringBitmap::Container::AndNot(const Container& other) {
+    if (IsBitset()) {
+        if (other.IsBitset()) {
+            for (uint32_t w = 0; w < BITSET_WORDS; ++w) words[w] &= ~other.words[w];
+            count = CountBits(words);
+        }
+        else {
+            for (uint32_t i = 0; i < other.count; ++i) {
+                uint16_t low = other.values[i];
+                uint64_t bit = uint64_t(1) << (low & 63);
+                if (words[low >> 6] & bit) --count;
+                words[low >> 6] &= ~bit;
+            }
+        }
+        Normalize();
+        return;
+    }
+
+    uint32_t n = 0;
+    if (other.IsBitset()) {
+        for (uint32_t i = 0; i < count; ++i) {
+            if (!TestBit(other.words, values[i])) values[n++] = values[i];
+        }
+    }
+    else {
+        uint32_t j = 0;
+        for (uint32_t i = 0; i < count; ++i) {
+            while (j < other.count && other.values[j] < values[i]) ++j;
+            if (j < other.count && other.values[j] == values[i]) continue;
+            values[n++] = values[i];
+        }
+    }
+    count = n;
+}
+
+// ==========================================
+// 2. BITMAP
+// ==========================================
+
+size_t RoaringBitmap::Find(uint16_t key) const {
+    size_t lo = 0, hi = containers.Count();
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (containers[mid]->key < key) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+void RoaringBitmap::Release() {
+    for (size_t i = 0; i < containers.Count(); ++i) delete containers[i];
+    containers.Clear();
+    size = 0;
+}
+
+void RoaringBitmap::Assign(const RoaringBitmap& other) {
+    if (this == &other) return;
+
+    Release();
+    for (size_t i = 0; i < other.containers.Count(); ++i) containers.Add(other.containers[i]->Clone());
+    size = other.size;
+}
+
+void RoaringBitmap::Add(uint32_t id) {
+    uint16_t key = static_cast<uint16_t>(id >> 16);
+
+    // Ascending ids land in the last container, or a new one after it
+    size_t at = containers.Count();
+    if (at == 0 || containers[at - 1]->key < key) {
+        containers.Add(new Container(key));
+    }
+    else if (containers[at - 1]->key == key) {
+        --at;
+    }
+    else {
+        at = Find(key);
+        if (containers[at]->key != key) containers.Insert(at, new Container(key));
+    }
+
+    if (containers[at]->Add(static_cast<uint16_t>(id))) ++size;
+}
+
+void RoaringBitmap::Remove(uint32_t id) {
+    uint16_t key = static_cast<uint16_t>(id >> 16);
+    size_t at = Find(key);
+    if (at == containers.Count() || containers[at]->key != key) return;
+
+    Container* container = containers[at];
+    if (!container->Remove(static_cast<uint16_t>(id))) return;
+
+    --size;
+    if (container->count == 0) {
+        delete container;
+        containers.RemoveAt(at);
+    }
+}
+
+bool RoaringBitmap::Contains(uint32_t id) const {
+    uint16_t key = static_cast<uint16_t>(id >> 16);
+    size_t at = Find(key);
+    return at < containers.Count() && containers[at]->key == key && containers[at]->Contains(static_cast<uint16_t>(id));
+}
+
+void RoaringBitmap::And(const RoaringBitmap& other) {
+    size_t kept = 0, j = 0;
+    size = 0;
+
+    for (size_t i = 0; i < containers.Count(); ++i) {
+        Container* container = containers[i];
+        while (j < other.containers.Count() && other.containers[j]->key < container->key) ++j;
+
+        if (j < other.containers.Count() && other.containers[j]->key == container->key) {
+            container->And(*other.containers[j]);
+        }
+        else {
+            container->count = 0;
+        }
+
+        if (container->count == 0) {
+            delete container;
+            continue;
+        }
+        size += container->count;
+        containers[kept++] = container;
+    }
+    while (containers.Count() > kept) containers.RemoveAt(containers.Count() - 1);
+}
+
+void RoaringBitmap::Or(const RoaringBitmap& other) {
+    ArrayList<Container*> merged(containers.Count() + other.containers.Count() + 1);
+    size_t i = 0, j = 0;
+    size = 0;
+
+    while (i < containers.Count() || j < other.containers.Count()) {
+        Container* next;
+        if (j == other.containers.Count() || (i < containers.Count() && containers[i]->key < other.containers[j]->key)) {
+            next = containers[i++];
+        }
+        else if (i == containers.Count() || other.containers[j]->key < containers[i]->key) {
+            next = other.containers[j++]->Clone();
+        }
+        else {
+            next = containers[i++];
+            next->Or(*other.containers[j++]);
+        }
+        size += next->count;
+        merged.Add(next);
+    }
+    containers = merged;
+}
+
+void RoaringBitmap::AndNot(const RoaringBitmap& other) {
+    size_t kept = 0, j = 0;
+    size = 0;
+
+    for (size_t i = 0; i < containers.Count(); ++i) {
+        Container* container = containers[i];
+        while (j < other.containers.Count() && other.containers[j]->key < container->key) ++j;
+
+        if (j < other.containers.Count() && other.containers[j]->key == container->key) {
+            container->AndNot(*other.containers[j]);
+            if (container->count == 0) {
+                delete container;
+                continue;
+            }
+        }
+        size += container->count;
+        containers[kept++] = container;
+    }
+    while (containers.Count() > kept) containers.RemoveAt(containers.Count() - 1);
+}
+
+size_t RoaringBitmap::BytesReserved() const {
+    size_t bytes = containers.BytesReserved();
+    for (size_t i = 0; i < containers.Count(); ++i) {
+        const Container* container = containers[i];
+        bytes += sizeof(Container);
+        bytes += container->IsBitset() ? BITSET_WORDS * sizeof(uint64_t) : container->capacity * sizeof(uint16_t);
+    }
+    return bytes;
+}
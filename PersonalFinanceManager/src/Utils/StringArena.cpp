@@ -0,0 +1,85 @@
+//
+//  StringArena.cpp
+//  PersonalFinanceManager
+//
+
+#include "Utils/StringArena.h"
+
+#include <cstring>
+#include <istream>
+#include <stdexcept>
+#include <utility>
+
+// ==========================================
+// 1. CONSTRUCTORS & DESTRUCTOR
+// ==========================================
+
+StringArena::StringArena() : data(nullptr), size(0), capacity(0), deadBytes(0) { }
+
+StringArena::StringArena(size_t initCap) : data(nullptr), size(0), capacity(0), deadBytes(0) {
+    Reserve(initCap);
+}
+
+StringArena::~StringArena() {
+    delete[] data;
+}
+
+void StringArena::Reserve(size_t required) {
+    if (required <= capacity) return;
+    if (required > UINT32_MAX) throw std::length_error("StringArena exceeds 4 GB");
+
+    size_t newCapacity = (capacity == 0) ? DEFAULT_CAPACITY : capacity;
+    while (newCapacity < required) newCapacity *= 2;
+    if (newCapacity > UINT32_MAX) newCapacity = UINT32_MAX;
+
+    char* newData = new char[newCapacity];
+    if (size > 0) std::memcpy(newData, data, size);
+
+    delete[] data;
+    data = newData;
+    capacity = newCapacity;
+}
+
+// ==========================================
+// 2. APPEND
+// ==========================================
+
+StringRef StringArena::Append(const char* str, size_t length) {
+    Reserve(size + length);
+
+    StringRef ref{ static_cast<uint32_t>(size), static_cast<uint32_t>(length) };
+    if (length > 0) std::memcpy(data + size, str, length);
+    size += length;
+    return ref;
+}
+
+StringRef StringArena::AppendFromStream(std::istream& in, size_t length) {
+    Reserve(size + length);
+
+    StringRef ref{ static_cast<uint32_t>(size), static_cast<uint32_t>(length) };
+    if (length > 0) in.read(data + size, length);
+    size += length;
+    return ref;
+}
+
+// ==========================================
+// 3. GENERATION MANAGEMENT
+// ==========================================
+
+void StringArena::Clear() {
+    size = 0;
+    deadBytes = 0;
+}
+
+void StringArena::Reset() {
+    delete[] data;
+    data = nullptr;
+    size = capacity = deadBytes = 0;
+}
+
+void StringArena::Swap(StringArena& other) {
+    std::swap(data, other.data);
+    std::swap(size, other.size);
+    std::swap(capacity, other.capacity);
+    std::swap(deadBytes, other.deadBytes);
+}
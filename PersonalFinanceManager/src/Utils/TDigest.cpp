@@ -0,0 +1,140 @@
+//
+//  TDigest.cpp
+//  PersonalFinanceManager
+//
+
+#include "Utils/TDigest.h"
+
+#include <algorithm>
+#include <cmath>
+
+static const double PI = 3.14159265358979323846;
+
+// Buffer slots per unit of compression; merged centroids stay near 1 per unit
+static const size_t SLOTS_PER_UNIT = 6;
+
+// ==========================================
+// 1. CONSTRUCTOR & DESTRUCTOR
+// ==========================================
+
+TDigest::TDigest(size_t c)
+    : merged(0), buffered(0), compression(static_cast<double>(c < 10 ? 10 : c)), totalWeight(0), minValue(0), maxValue(0) {
+    capacity = SLOTS_PER_UNIT * static_cast<size_t>(compression);
+    centroids = new Centroid[capacity];
+}
+
+TDigest::~TDigest() {
+    delete[] centroids;
+}
+
+// ==========================================
+// 2. COMPRESSION
+// ==========================================
+
+/// Largest quantile a centroid starting at quantile q may reach: one unit further along k(q).
+double TDigest::QuantileLimit(double q) const {
+    double k = compression / (2 * PI) * std::asin(2 * q - 1) + 1;
+    if (k >= compression / 4) return 1;
+    return (std::sin(k * 2 * PI / compression) + 1) / 2;
+}
+
+void TDigest::Compress() {
+    if (buffered == 0) return;
+
+    size_t total = merged + buffered;
+    std::sort(centroids, centroids + total, [](const Centroid& a, const Centroid& b) { return a.mean < b.mean; });
+
+    // One pass left to right: absorb the next centroid while the result stays within its limit
+    size_t out = 0;
+    double before = 0;
+    double limit = QuantileLimit(0) * totalWeight;
+    Centroid current = centroids[0];
+    for (size_t i = 1; i < total; ++i) {
+        const Centroid& next = centroids[i];
+        if (before + current.weight + next.weight <= limit) {
+            current.weight += next.weight;
+            current.mean += (next.mean - current.mean) * next.weight / current.weight;
+        }
+        else {
+            centroids[out++] = current;
+            before += current.weight;
+            limit = QuantileLimit(before / totalWeight) * totalWeight;
+            current = next;
+        }
+    }
+    centroids[out++] = current;
+
+    merged = out;
+    buffered = 0;
+}
+
+// ==========================================
+// 3. UPDATES
+// ==========================================
+
+void TDigest::Add(double value, double weight) {
+    if (weight <= 0) return;
+    if (merged + buffered == capacity) Compress();
+
+    if (totalWeight == 0 || value < minValue) minValue = value;
+    if (totalWeight == 0 || value > maxValue) maxValue = value;
+
+    centroids[merged + buffered].mean = value;
+    centroids[merged + buffered].weight = weight;
+    ++buffered;
+    totalWeight += weight;
+}
+
+void TDigest::Merge(TDigest& other) {
+    if (other.IsEmpty()) return;
+    other.Compress();
+
+    double low = other.minValue, high = other.maxValue;
+    bool empty = IsEmpty();
+    for (size_t i = 0; i < other.merged; ++i) {
+        Add(other.centroids[i].mean, other.centroids[i].weight);
+    }
+    // Centroid means lie inside the other digest's range; its exact extremes still count
+    if (empty || low < minValue) minValue = low;
+    if (empty || high > maxValue) maxValue = high;
+}
+
+void TDigest::Clear() {
+    merged = buffered = 0;
+    totalWeight = 0;
+    minValue = maxValue = 0;
+}
+
+// ==========================================
+// 4. QUERIES
+// ==========================================
+
+double TDigest::Quantile(double q) {
+    if (totalWeight == 0) return 0;
+    if (q <= 0) return minValue;
+    if (q >= 1) return maxValue;
+    Compress();
+
+    // Interpolate between centroid centres, anchored at the exact min (rank 0) and max (rank N)
+    double rank = q * totalWeight;
+    double lastRank = 0, lastValue = minValue;
+    double before = 0;
+    for (size_t i = 0; i < merged; ++i) {
+        double centre = before + centroids[i].weight / 2;
+        if (rank < centre) {
+            double share = (rank - lastRank) / (centre - lastRank);
+            return lastValue + share * (centroids[i].mean - lastValue);
+        }
+        lastRank = centre;
+        lastValue = centroids[i].mean;
+        before += centroids[i].weight;
+    }
+
+    double share = (rank - lastRank) / (totalWeight - lastRank);
+    return lastValue + share * (maxValue - lastValue);
+}
+
+size_t TDigest::CentroidCount() {
+    Compress();
+    return merged;
+}
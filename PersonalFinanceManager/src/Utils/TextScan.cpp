@@ -0,0 +1,255 @@
+//
+//  TextScan.cpp
+//  PersonalFinanceManager
+//
+
+#include "Utils/TextScan.h"
+
+#include <cstring>
+#include <string_view>
+
+// SSE2 is part of x86-64; AVX2 needs a run-time check and per-function target (GCC/Clang).
+// PFM_NO_AVX2 stops at SSE2 and PFM_NO_SIMD at the scalar loop (used to benchmark each kernel).
+#if !defined(PFM_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+#define TEXTSCAN_SSE2 1
+#include <emmintrin.h>
+#if defined(__GNUC__) && !defined(PFM_NO_AVX2)
+#define TEXTSCAN_AVX2 1
+#include <immintrin.h>
+#endif
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// ==========================================
+// 1. SHARED HELPERS
+// ==========================================
+
+/// Kernel signature: with 'marks' == nullptr it stops at the first match.
+using ScanKernel = size_t (*)(const char*, size_t, const char*, size_t, bool, uint64_t*);
+
+static unsigned char Fold(unsigned char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<unsigned char>(c - 'A' + 'a') : c;
+}
+
+static bool EqualBytes(const char* a, const char* b, size_t n, bool ignoreCase) {
+    if (!ignoreCase) return std::memcmp(a, b, n) == 0;
+    for (size_t i = 0; i < n; ++i) {
+        if (Fold(static_cast<unsigned char>(a[i])) != Fold(static_cast<unsigned char>(b[i]))) return false;
+    }
+    return true;
+}
+
+/// Records a match at 'position'; false means "stop" (first-match mode).
+static bool Report(size_t position, uint64_t* marks) {
+    if (marks == nullptr) return false;
+    marks[position / 64] |= uint64_t(1) << (position % 64);
+    return true;
+}
+
+/// Verifies the bytes between the first and last of a candidate position.
+static bool MiddleMatches(const char* candidate, const char* needle, size_t needleLength, bool ignoreCase) {
+    return needleLength <= 2 || EqualBytes(candidate + 1, needle + 1, needleLength - 2, ignoreCase);
+}
+
+// ==========================================
+// 2. SCALAR KERNEL
+// ==========================================
+
+/// Positions [start, length - needleLength], one at a time.
+static size_t ScanScalarFrom(const char* text, size_t length, size_t start, const char* needle, size_t needleLength,
+                             bool ignoreCase, uint64_t* marks) {
+    size_t found = 0;
+    if (length < needleLength) return 0;
+
+    if (!ignoreCase) {
+        // string_view::find jumps between first-byte hits with memchr
+        std::string_view haystack(text, length), pattern(needle, needleLength);
+        for (size_t at = haystack.find(pattern, start); at != std::string_view::npos; at = haystack.find(pattern, at + 1)) {
+            ++found;
+            if (!Report(at, marks)) break;
+        }
+        return found;
+    }
+
+    unsigned char first = Fold(static_cast<unsigned char>(needle[0]));
+    unsigned char last = Fold(static_cast<unsigned char>(needle[needleLength - 1]));
+    for (size_t i = start; i + needleLength <= length; ++i) {
+        if (Fold(static_cast<unsigned char>(text[i])) != first) continue;
+        if (Fold(static_cast<unsigned char>(text[i + needleLength - 1])) != last) continue;
+        if (!MiddleMatches(text + i, needle, needleLength, true)) continue;
+
+        ++found;
+        if (!Report(i, marks)) break;
+    }
+    return found;
+}
+
+#if !TEXTSCAN_SSE2
+static size_t ScanScalar(const char* text, size_t length, const char* needle, size_t needleLength, bool ignoreCase, uint64_t* marks) {
+    return ScanScalarFrom(text, length, 0, needle, needleLength, ignoreCase, marks);
+}
+#endif
+
+// ==========================================
+// 3. SSE2 KERNEL (16 positions per step)
+// ==========================================
+
+#if TEXTSCAN_SSE2
+static unsigned CountTrailingZeros(uint32_t mask) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+}
+
+static __m128i FoldSse2(__m128i bytes) {
+    __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8('A' - 1)),
+                                  _mm_cmplt_epi8(bytes, _mm_set1_epi8('Z' + 1)));
+    return _mm_or_si128(bytes, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+}
+
+static size_t ScanSse2(const char* text, size_t length, const char* needle, size_t needleLength, bool ignoreCase, uint64_t* marks) {
+    size_t found = 0;
+    size_t lastOffset = needleLength - 1;
+    const __m128i first = _mm_set1_epi8(static_cast<char>(ignoreCase ? Fold(static_cast<unsigned char>(needle[0])) : needle[0]));
+    const __m128i last = _mm_set1_epi8(static_cast<char>(ignoreCase ? Fold(static_cast<unsigned char>(needle[lastOffset])) : needle[lastOffset]));
+
+    size_t i = 0;
+    for (; i + lastOffset + 16 <= length; i += 16) {
+        __m128i head = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+        __m128i tail = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i + lastOffset));
+        if (ignoreCase) {
+            head = FoldSse2(head);
+            tail = FoldSse2(tail);
+        }
+
+        uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(head, first), _mm_cmpeq_epi8(tail, last))));
+        while (mask != 0) {
+            size_t at = i + CountTrailingZeros(mask);
+            mask &= mask - 1;
+            if (!MiddleMatches(text + at, needle, needleLength, ignoreCase)) continue;
+
+            ++found;
+            if (!Report(at, marks)) return found;
+        }
+    }
+    return found + ScanScalarFrom(text, length, i, needle, needleLength, ignoreCase, marks);
+}
+#endif
+
+// ==========================================
+// 4. AVX2 KERNEL (32 positions per step)
+// ==========================================
+
+#if TEXTSCAN_AVX2
+__attribute__((target("avx2")))
+static __m256i FoldAvx2(__m256i bytes) {
+    __m256i upper = _mm256_and_si256(_mm256_cmpgt_epi8(bytes, _mm256_set1_epi8('A' - 1)),
+                                     _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), bytes));
+    return _mm256_or_si256(bytes, _mm256_and_si256(upper, _mm256_set1_epi8(0x20)));
+}
+
+__attribute__((target("avx2")))
+static size_t ScanAvx2(const char* text, size_t length, const char* needle, size_t needleLength, bool ignoreCase, uint64_t* marks) {
+    size_t found = 0;
+    size_t lastOffset = needleLength - 1;
+    const __m256i first = _mm256_set1_epi8(static_cast<char>(ignoreCase ? Fold(static_cast<unsigned char>(needle[0])) : needle[0]));
+    const __m256i last = _mm256_set1_epi8(static_cast<char>(ignoreCase ? Fold(static_cast<unsigned char>(needle[lastOffset])) : needle[lastOffset]));
+
+    size_t i = 0;
+    for (; i + lastOffset + 32 <= length; i += 32) {
+        __m256i head = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i));
+        __m256i tail = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i + lastOffset));
+        if (ignoreCase) {
+            head = FoldAvx2(head);
+            tail = FoldAvx2(tail);
+        }
+
+        uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(head, first), _mm256_cmpeq_epi8(tail, last))));
+        while (mask != 0) {
+            size_t at = i + CountTrailingZeros(mask);
+            mask &= mask - 1;
+            if (!MiddleMatches(text + at, needle, needleLength, ignoreCase)) continue;
+
+            ++found;
+            if (!Report(at, marks)) return found;
+        }
+    }
+    return found + ScanScalarFrom(text, length, i, needle, needleLength, ignoreCase, marks);
+}
+#endif
+
+// ==========================================
+// 5. DISPATCH
+// ==========================================
+
+static ScanKernel PickKernel(const char*& name) {
+#if TEXTSCAN_AVX2
+    if (__builtin_cpu_supports("avx2")) {
+        name = "avx2";
+        return ScanAvx2;
+    }
+#endif
+#if TEXTSCAN_SSE2
+    name = "sse2";
+    return ScanSse2;
+#else
+    name = "scalar";
+    return ScanScalar;
+#endif
+}
+
+static ScanKernel ActiveKernel(const char** nameOut = nullptr) {
+    static const char* name = "scalar";
+    static const ScanKernel kernel = PickKernel(name);
+    if (nameOut != nullptr) *nameOut = name;
+    return kernel;
+}
+
+// ==========================================
+// 6. PUBLIC API
+// ==========================================
+
+bool TextScan::Contains(const char* text, size_t length, const char* needle, size_t needleLength, bool ignoreCase) {
+    if (needleLength == 0) return true;
+    if (length < needleLength) return false;
+
+    // Too short for one vector step (most descriptions): skip the dispatch
+    if (length < needleLength + 31) {
+        if (!ignoreCase) return std::string_view(text, length).find(std::string_view(needle, needleLength)) != std::string_view::npos;
+        return ScanScalarFrom(text, length, 0, needle, needleLength, true, nullptr) > 0;
+    }
+    return ActiveKernel()(text, length, needle, needleLength, ignoreCase, nullptr) > 0;
+}
+
+size_t TextScan::MarkAll(const char* text, size_t length, const char* needle, size_t needleLength, bool ignoreCase, uint64_t* marks) {
+    if (needleLength == 0 || length < needleLength) return 0;
+    return ActiveKernel()(text, length, needle, needleLength, ignoreCase, marks);
+}
+
+bool TextScan::AnyMarked(const uint64_t* marks, size_t first, size_t last) {
+    size_t firstWord = first / 64, lastWord = last / 64;
+    uint64_t lowMask = ~uint64_t(0) << (first % 64);
+    uint64_t highMask = ~uint64_t(0) >> (63 - last % 64);
+
+    if (firstWord == lastWord) return (marks[firstWord] & lowMask & highMask) != 0;
+    if (marks[firstWord] & lowMask) return true;
+    for (size_t w = firstWord + 1; w < lastWord; ++w) {
+        if (marks[w] != 0) return true;
+    }
+    return (marks[lastWord] & highMask) != 0;
+}
+
+const char* TextScan::KernelName() {
+    const char* name = nullptr;
+    ActiveKernel(&name);
+    return name;
+}
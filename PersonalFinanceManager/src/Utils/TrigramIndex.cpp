@@ -0,0 +1,245 @@
+//
+//  TrigramIndex.cpp
+//  PersonalFinanceManager
+//
+
+#include "Utils/TrigramIndex.h"
+
+#include <algorithm>
+
+// A list this many times longer than the surviving candidates costs more to
+// decode than verifying those candidates directly, so it is left unread.
+static const size_t MAX_SKEW = 16;
+
+static unsigned char Fold(unsigned char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<unsigned char>(c - 'A' + 'a') : c;
+}
+
+/// Sorts 'list' and drops repeated values.
+template <typename T>
+static void SortUnique(ArrayList<T>& list) {
+    if (list.IsEmpty()) return;
+    std::sort(list.begin(), list.end());
+
+    size_t kept = 1;
+    for (size_t i = 1; i < list.Count(); ++i) {
+        if (list[i] != list[kept - 1]) list[kept++] = list[i];
+    }
+    while (list.Count() > kept) list.RemoveAt(list.Count() - 1);
+}
+
+// ==========================================
+// 1. CONSTRUCTOR & DESTRUCTOR
+// ==========================================
+
+TrigramIndex::TrigramIndex() : lists(new HashMap<int, PostingList*>()), postings(0), scratch(64) {
+}
+
+TrigramIndex::~TrigramIndex() {
+    Clear();
+    delete lists;
+}
+
+// ==========================================
+// 2. UPDATES
+// ==========================================
+
+void TrigramIndex::PostingList::Append(uint32_t slot) {
+    // Room for one 5-byte varint; grow by half, since there are many long-lived lists
+    if (capacity - length < 5) {
+        uint32_t grown = (capacity == 0) ? 8 : capacity + capacity / 2;
+        uint8_t* moved = new uint8_t[grown];
+        std::copy(bytes, bytes + length, moved);
+        delete[] bytes;
+        bytes = moved;
+        capacity = grown;
+    }
+
+    uint32_t gap = (count == 0) ? slot : slot - last;
+    while (gap >= 0x80) {
+        bytes[length++] = static_cast<uint8_t>(gap | 0x80);
+        gap >>= 7;
+    }
+    bytes[length++] = static_cast<uint8_t>(gap);
+
+    last = slot;
+    ++count;
+}
+
+int TrigramIndex::Key(const char* window) {
+    uint32_t packed = (Fold(static_cast<unsigned char>(window[0])) << 16) |
+                      (Fold(static_cast<unsigned char>(window[1])) << 8) |
+                       Fold(static_cast<unsigned char>(window[2]));
+
+    // HashMap<int> buckets by the low bits, which hold only the last two bytes;
+    // an invertible mix spreads all three bytes while keeping keys distinct
+    uint32_t mixed = packed * 0x9E3779B1u;
+    return static_cast<int>(mixed ^ (mixed >> 15));
+}
+
+void TrigramIndex::Keys(const char* text, size_t length, ArrayList<int>& out) {
+    out.Clear();
+    for (size_t i = 0; i + 3 <= length; ++i) out.Add(Key(text + i));
+    SortUnique(out);
+}
+
+void TrigramIndex::Add(uint32_t slot, const char* text, size_t length) {
+    Keys(text, length, scratch);
+
+    for (size_t i = 0; i < scratch.Count(); ++i) {
+        PostingList*& list = (*lists)[scratch[i]];
+        if (list == nullptr) list = new PostingList();
+        list->Append(slot);
+        ++postings;
+    }
+}
+
+void TrigramIndex::Clear() {
+    ArrayList<PostingList*> owned = lists->Values();
+    for (size_t i = 0; i < owned.Count(); ++i) delete owned[i];
+    lists->Clear();
+    postings = 0;
+}
+
+// ==========================================
+// 3. SEARCH
+// ==========================================
+
+void TrigramIndex::Lookup(const char* pattern, size_t length, ArrayList<const PostingList*>& out, size_t& missing) const {
+    ArrayList<int> keys(length + 1);
+    Keys(pattern, length, keys);
+
+    missing = 0;
+    for (size_t i = 0; i < keys.Count(); ++i) {
+        PostingList** list = lists->Get(keys[i]);
+        if (list == nullptr) ++missing;
+        else out.Add(*list);
+    }
+
+    // Shortest first: they seed the candidates and cut them down fastest
+    std::sort(out.begin(), out.end(), [](const PostingList* a, const PostingList* b) { return a->count < b->count; });
+}
+
+/*
+ * Count filter (q-gram lemma): one edit touches at most 3 trigram windows of
+ * the pattern, so a text within k edits still holds all but 3k of the
+ * pattern's distinct trigrams. A match must therefore appear in at least one
+ * of the 3k + 1 shortest lists (missing trigrams count as empty lists); those
+ * lists seed the candidates, and the remaining lists only count hits.
+ */
+bool TrigramIndex::Candidates(const char* pattern, size_t length, int maxEdits, ArrayList<uint32_t>& out) const {
+    ArrayList<const PostingList*> found(length + 1);
+    size_t missing = 0;
+    Lookup(pattern, length, found, missing);
+
+    size_t distinct = found.Count() + missing;
+    size_t lost = 3 * static_cast<size_t>(maxEdits);
+    if (distinct <= lost) return false;
+
+    size_t needed = distinct - lost;
+    size_t seedLists = lost + 1;
+    out.Clear();
+    if (seedLists <= missing) return true;
+    seedLists -= missing;
+
+    // Seeds: union of the shortest lists, with how many of them hold each slot
+    for (size_t i = 0; i < seedLists; ++i) {
+        found[i]->ForEach([&](uint32_t slot) { out.Add(slot); });
+    }
+    std::sort(out.begin(), out.end());
+
+    ArrayList<uint32_t> hits(out.Count() + 1);
+    size_t kept = 0;
+    for (size_t i = 0; i < out.Count(); ++i) {
+        if (kept > 0 && out[kept - 1] == out[i]) {
+            ++hits[kept - 1];
+            continue;
+        }
+        out[kept++] = out[i];
+        hits.Add(1);
+    }
+    while (out.Count() > kept) out.RemoveAt(out.Count() - 1);
+
+    // Merge the longer lists in, shortest first, while they are worth decoding
+    size_t unread = found.Count() - seedLists;
+    for (size_t i = seedLists; i < found.Count() && !out.IsEmpty(); ++i) {
+        if (found[i]->count > MAX_SKEW * out.Count()) break;
+
+        size_t at = 0;
+        found[i]->ForEach([&](uint32_t slot) {
+            while (at < out.Count() && out[at] < slot) ++at;
+            if (at < out.Count() && out[at] == slot) ++hits[at];
+        });
+        --unread;
+
+        // Drop slots that can no longer reach 'needed' hits
+        size_t survivors = 0;
+        for (size_t j = 0; j < out.Count(); ++j) {
+            if (hits[j] + unread < needed) continue;
+            out[survivors] = out[j];
+            hits[survivors] = hits[j];
+            ++survivors;
+        }
+        while (out.Count() > survivors) out.RemoveAt(out.Count() - 1);
+    }
+    return true;
+}
+
+bool TrigramIndex::EstimateCandidates(const char* pattern, size_t length, int maxEdits, size_t& rows) const {
+    ArrayList<const PostingList*> found(length + 1);
+    size_t missing = 0;
+    Lookup(pattern, length, found, missing);
+
+    size_t lost = 3 * static_cast<size_t>(maxEdits);
+    if (found.Count() + missing <= lost) return false;
+
+    rows = 0;
+    size_t seedLists = lost + 1;
+    for (size_t i = 0; i + missing < seedLists && i < found.Count(); ++i) rows += found[i]->count;
+    return true;
+}
+
+/*
+ * Approximate substring match (Sellers): dynamic programming over the
+ * pattern with a free starting position in the text, one column per text
+ * byte. Column i holds the fewest edits turning pattern[0, i) into some text
+ * substring ending at the current byte.
+ */
+bool TrigramIndex::ContainsApproximately(const char* text, size_t length, const char* pattern, size_t patternLength, int maxEdits) {
+    size_t m = (patternLength < MAX_FUZZY_LENGTH) ? patternLength : MAX_FUZZY_LENGTH;
+    if (m <= static_cast<size_t>(maxEdits)) return true;
+
+    int column[MAX_FUZZY_LENGTH + 1];
+    for (size_t i = 0; i <= m; ++i) column[i] = static_cast<int>(i);
+
+    for (size_t j = 0; j < length; ++j) {
+        unsigned char c = Fold(static_cast<unsigned char>(text[j]));
+        int diagonal = column[0]; // Previous column, row i - 1
+        for (size_t i = 1; i <= m; ++i) {
+            int above = column[i];
+            int substitute = diagonal + (Fold(static_cast<unsigned char>(pattern[i - 1])) == c ? 0 : 1);
+            column[i] = std::min(substitute, std::min(above, column[i - 1]) + 1);
+            diagonal = above;
+        }
+        if (column[m] <= maxEdits) return true;
+    }
+    return false;
+}
+
+// ==========================================
+// 4. DIAGNOSTICS
+// ==========================================
+
+size_t TrigramIndex::BytesReserved() const {
+    size_t bytes = lists->BytesReserved() + scratch.BytesReserved();
+    ArrayList<PostingList*> owned = lists->Values();
+    for (size_t i = 0; i < owned.Count(); ++i) bytes += sizeof(PostingList) + owned[i]->capacity;
+    return bytes;
+}
+
+size_t TrigramIndex::BytesUnused() const {
+    size_t bytes = 0;
+    ArrayList<PostingList*> owned = lists->Values();
+    for (size_t i = 0; i < owned.Count(); ++i) bytes += owned[i]->capacity - owned[i]->length;
+    return bytes;
+}
@@ -8,8 +8,8 @@
 
 char Dashboard::Display() {
     // Precompute table width for wallet list so header/footer match
-    int dashboardTableWidths[] = {25, 25, 15};
-    int dashboardNumCols = 3;
+    int dashboardTableWidths[] = {22, 18, 14, 16, 16};
+    int dashboardNumCols = 5;
     int dashboardTableWidth = 1; for (int i = 0; i < dashboardNumCols; ++i) dashboardTableWidth += dashboardTableWidths[i] + 1;
 
     view.ClearScreen();
@@ -17,7 +17,7 @@ char Dashboard::Display() {
 
     // Prefer live in-memory data from AppController if bound
     ArrayList<Wallet*>* wallets = nullptr;
-    ArrayList<Transaction*>* transactions = nullptr;
+    TransactionLedger* transactions = nullptr;
 
     if (appController) {
         wallets = appController->GetWalletsList();
@@ -52,30 +52,26 @@ char Dashboard::Display() {
     }
 
     // Display wallet list
-    std::string headers[] = {"Wallet Name", "Balance", "Transactions"};
-    int widths[] = {25, 25, 15};
-    int numCols = 3;
+    std::string headers[] = {"Wallet Name", "Balance", "Transactions", "Income (MTD)", "Expense (MTD)"};
+    int widths[] = {22, 18, 14, 16, 16};
+    int numCols = 5;
 
     view.PrintTableHeader(headers, widths, numCols);
     if (!appController || !wallets || wallets->Count() == 0) {
-        std::string row[] = {"No wallets found", "", ""};
+        std::string row[] = {"No wallets found", "", "", "", ""};
         view.PrintTableRow(row, widths, numCols);
     } else {
         for (size_t i = 0; i < wallets->Count(); ++i) {
             Wallet* w = wallets->Get(i);
-            // Count transactions for this wallet
-            int txCount = 0;
-            if (transactions) {
-                for (size_t j = 0; j < transactions->Count(); ++j) {
-                    Transaction* t = transactions->Get(j);
-                    if (t->GetWalletId() == w->GetId()) ++txCount;
-                }
-            }
+            // Count and month-to-date flows from maintained counters, no scan of the history
+            WalletStats stats = appController->GetWalletStats(w->GetId(), today);
 
             std::string name = w->GetName();
             std::string balance = view.FormatCurrency(static_cast<long long>(w->GetBalance()));
-            std::string txs = std::to_string(txCount);
-            std::string row[] = {name, balance, txs};
+            std::string txs = std::to_string(stats.transactions);
+            std::string income = view.FormatCurrency(static_cast<long long>(stats.monthToDate.income));
+            std::string expense = view.FormatCurrency(static_cast<long long>(stats.monthToDate.expense));
+            std::string row[] = {name, balance, txs, income, expense};
             view.PrintTableRow(row, widths, numCols);
         }
     }
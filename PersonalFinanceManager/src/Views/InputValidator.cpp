@@ -95,6 +95,42 @@ Date InputValidator::GetOptionalDate(const string& prompt) {
     }
 }
 
+// Returns 0 if the user submits a blank line.
+double InputValidator::GetOptionalMoney(const string& prompt) {
+    string line;
+    while (true) {
+        cout << prompt;
+        if (!std::getline(cin, line)) return 0; // EOF -> treat as none
+
+        size_t start = line.find_first_not_of(" \t\r\n");
+        if (start == std::string::npos) return 0;
+
+        try {
+            size_t used = 0;
+            double amount = std::stod(line.substr(start), &used);
+            if (amount >= 0 && line.find_first_not_of(" \t\r\n", start + used) == std::string::npos) {
+                return amount;
+            }
+        } catch (...) {
+            // Not a number
+        }
+
+        ConsoleView view;
+        view.ShowError("Invalid amount! Enter a number (0 or more), or leave blank for none.");
+    }
+}
+
+string InputValidator::GetOptionalString(const string& prompt) {
+    string input;
+    cout << prompt;
+    if (!getline(cin, input)) return "";
+
+    size_t start = input.find_first_not_of(" \t\r\n");
+    if (start == std::string::npos) return "";
+    size_t end = input.find_last_not_of(" \t\r\n");
+    return input.substr(start, end - start + 1);
+}
+
 string InputValidator::GetValidString(const string& prompt) {
     string input;
     while (true) {
@@ -106,8 +106,8 @@ char Menus::DisplayReportsMenu() {
     view.ClearScreen();
     view.PrintHeader(REPORTS_MENU_TITLE);
     
-    // Vẽ khung to hơn để chứa đủ 5 dòng
-    view.PrintBox(8, 5, 40, 7); 
+    // Vẽ khung to hơn để chứa đủ 8 dòng
+    view.PrintBox(8, 5, 40, 10); 
 
     view.MoveToXY(10, 6);
     cout << REPORTS_MENU_1 << endl;
@@ -121,8 +121,14 @@ char Menus::DisplayReportsMenu() {
     // Hiển thị mục số 5
     view.MoveToXY(10, 10);
     cout << REPORTS_MENU_5 << endl;
+    view.MoveToXY(10, 11);
+    cout << REPORTS_MENU_6 << endl;
+    view.MoveToXY(10, 12);
+    cout << REPORTS_MENU_7 << endl;
+    view.MoveToXY(10, 13);
+    cout << REPORTS_MENU_8 << endl;
 
-    view.PrintShortcutFooter("[1-5] Select | [ESC] Back", "Reports Menu");
+    view.PrintShortcutFooter("[1-8] Select | [ESC] Back", "Reports Menu");
     
     return GetKeyPress(); 
 }
@@ -188,7 +194,7 @@ char Menus::DisplayRecurringMenu() {
 char Menus::DisplaySearchMenu() {
     view.ClearScreen();
     view.PrintHeader(SEARCH_MENU_TITLE);
-    view.PrintBox(8, 5, 40, 8);
+    view.PrintBox(8, 5, 40, 9);
 
     view.MoveToXY(10, 6);
     cout << SEARCH_MENU_1 << endl;
@@ -202,8 +208,10 @@ char Menus::DisplaySearchMenu() {
     cout << SEARCH_MENU_5 << endl;
     view.MoveToXY(10, 11);
     cout << SEARCH_MENU_6 << endl;
+    view.MoveToXY(10, 12);
+    cout << SEARCH_MENU_7 << endl;
 
-    view.PrintShortcutFooter("[1-6] Select | [ESC] Back", "Search Menu");
+    view.PrintShortcutFooter("[1-7] Select | [ESC] Back", "Search Menu");
     
     return GetKeyPress();
 }
@@ -254,9 +262,12 @@ const string Menus::WALLET_MENU_3 = "3. Delete Wallet";
 const string Menus::REPORTS_MENU_TITLE = "REPORTS & STATISTICS";
 const string Menus::REPORTS_MENU_1 = "1. Monthly Summary";
 const string Menus::REPORTS_MENU_2 = "2. Spending by Category";
-const string Menus::REPORTS_MENU_3 = "3. Income vs Expense";
+const string Menus::REPORTS_MENU_3 = "3. Income vs Expense (Compare)";
 const string Menus::REPORTS_MENU_4 = "4. Wallet Balance Overview";
 const string Menus::REPORTS_MENU_5 = "5. Income by Source";
+const string Menus::REPORTS_MENU_6 = "6. Memory Usage";
+const string Menus::REPORTS_MENU_7 = "7. Largest Expenses";
+const string Menus::REPORTS_MENU_8 = "8. Spending Percentiles";
 
 // Add Income Form
 const string Menus::ADD_INCOME_TITLE = "=== ADD INCOME ===";
@@ -288,3 +299,4 @@ const string Menus::SEARCH_MENU_3 = "3. Filter by Category";
 const string Menus::SEARCH_MENU_4 = "4. Filter by Income Source";
 const string Menus::SEARCH_MENU_5 = "5. Filter by Amount Range";
 const string Menus::SEARCH_MENU_6 = "6. Filter by Date Range";
+const string Menus::SEARCH_MENU_7 = "7. Advanced Search (Combined)";
@@ -1,10 +1,24 @@
 #include <iostream>
+#include <cstring>
 #include "Controllers/AppController.h"
 #include "Controllers/NavigationController.h"
 #include "Views/ConsoleView.h"
 #include "Utils/PlatformUtils.h"
 
-int main() {
+int main(int argc, char* argv[]) {
+    // Headless: load the data files, print the memory report and exit
+    if (argc > 1 && std::strcmp(argv[1], "--memory-report") == 0) {
+        try {
+            AppController appController(nullptr);
+            appController.GetMemoryReport().Print(std::cout);
+            return 0;
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Fatal error: " << e.what() << std::endl;
+            return 1;
+        }
+    }
+
     SetupConsole();
     
     try {